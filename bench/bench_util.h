@@ -0,0 +1,24 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// 基准测试共用的小工具
+namespace bench {
+
+inline double NowSeconds() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// 第index个命令行参数, 没给就用默认值
+inline long ArgOr(int argc, char* argv[], int index, long default_value) {
+    return argc > index ? std::atol(argv[index]) : default_value;
+}
+
+// 一行结果: 名字, 总次数, 每次的耗时
+inline void Report(const char* name, long iterations, double seconds) {
+    printf("%-40s %10ld iterations %12.1f ns/op\n", name, iterations, seconds * 1e9 / iterations);
+}
+
+} // namespace bench
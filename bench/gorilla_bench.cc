@@ -0,0 +1,68 @@
+// Gorilla压缩块: 每条采样占多少字节, 编码和解码的速度
+// 用法: gorilla_bench [采样条数, 默认1000000]
+#include <cstdio>
+#include <deque>
+#include <random>
+
+#include "bench_util.h"
+#include "gorilla.h"
+
+namespace {
+
+// 接近collector实际上报的数据: 3秒一条, 偶尔有几毫秒的抖动; 使用率是百分之一精度的随机游走
+std::vector<Sample> MakeSamples(long count) {
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> jitter(-3, 3);
+    std::uniform_int_distribution<int> step(-150, 150);
+    std::vector<Sample> samples;
+    samples.reserve(count);
+    int64_t timestamp = 1700000000000LL;
+    int cpu = 2500, memory = 6000;
+    for (long i = 0; i < count; ++i) {
+        timestamp += 3000 + (i % 16 == 0 ? jitter(random) : 0);
+        cpu = std::min(10000, std::max(0, cpu + step(random)));
+        memory = std::min(10000, std::max(0, memory + step(random) / 10));
+        samples.push_back({timestamp, cpu / 100.0f, memory / 100.0f});
+    }
+    return samples;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    long count = bench::ArgOr(argc, argv, 1, 1000000);
+    std::vector<Sample> samples = MakeSamples(count);
+
+    std::deque<GorillaChunk> chunks;
+    double start = bench::NowSeconds();
+    for (const Sample& sample : samples) {
+        if (chunks.empty() || chunks.back().Full(sample.timestamp)) {
+            chunks.emplace_back();
+        }
+        chunks.back().Append(sample);
+    }
+    bench::Report("encode", count, bench::NowSeconds() - start);
+
+    size_t bytes = 0;
+    for (const auto& chunk : chunks) {
+        bytes += chunk.bytes();
+    }
+    printf("%zu chunks, %zu bytes, %.2f bytes/sample (raw Sample is %zu bytes)\n",
+           chunks.size(), bytes, static_cast<double>(bytes) / count, sizeof(Sample));
+
+    start = bench::NowSeconds();
+    long decoded = 0;
+    double checksum = 0;
+    for (const auto& chunk : chunks) {
+        GorillaChunk::Iterator it = chunk.Begin();
+        Sample sample;
+        while (it.Next(&sample)) {
+            checksum += sample.cpu_usage;
+            ++decoded;
+        }
+    }
+    double seconds = bench::NowSeconds() - start;
+    bench::Report("decode", decoded, seconds);
+    printf("decode throughput %.1f M samples/s (checksum %.0f)\n", decoded / seconds / 1e6, checksum);
+    return decoded == count ? 0 : 1;
+}
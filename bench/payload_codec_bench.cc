@@ -0,0 +1,83 @@
+// 查询响应的压缩: 不同大小的全量概览压缩比多少, 压缩和解压各花多少CPU
+// 用法: payload_codec_bench [每种大小的重复次数, 默认2000] [最多主机数, 默认10000]
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+
+#include "bench_util.h"
+#include "monitor.pb.h"
+#include "payload_codec.h"
+
+namespace {
+
+// 接近全量概览的响应: 主机名有共同前缀, 时间戳挨得很近, 使用率是百分之一精度
+dmonitor::QueryResponse MakeOverview(long hosts) {
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> usage(0, 10000);
+    std::uniform_int_distribution<int> jitter(0, 3000);
+    dmonitor::QueryResponse response;
+    for (long i = 0; i < hosts; ++i) {
+        dmonitor::MetricsData* data = response.add_metrics();
+        char name[32];
+        snprintf(name, sizeof(name), "web-%05ld.prod", i);
+        data->set_server_name(name);
+        data->set_timestamp(1700000000000LL + jitter(random));
+        data->set_cpu_usage(usage(random) / 100.0f);
+        data->set_memory_usage(usage(random) / 100.0f);
+    }
+    response.mutable_result()->set_errcode(0);
+    response.set_success(true);
+    return response;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    long rounds = bench::ArgOr(argc, argv, 1, 2000);
+    long max_hosts = bench::ArgOr(argc, argv, 2, 10000);
+    dmonitor::QueryRequest request;
+    request.add_accept_codecs(dmonitor::CODEC_ZLIB);
+
+    printf("%8s %10s %10s %7s\n", "hosts", "raw", "zlib", "ratio");
+    for (long hosts = 10; hosts <= max_hosts; hosts *= 10) {
+        const dmonitor::QueryResponse original = MakeOverview(hosts);
+        // 大响应少跑几轮, 每种大小总的字节数差不多
+        long iterations = std::max(1L, rounds * 10 / hosts);
+
+        dmonitor::QueryResponse response;
+        double compress_seconds = 0;
+        double decompress_seconds = 0;
+        for (long i = 0; i < iterations; ++i) {
+            response = original;
+            double start = bench::NowSeconds();
+            payload::CompressResponse(request, &response, 0);
+            compress_seconds += bench::NowSeconds() - start;
+
+            start = bench::NowSeconds();
+            if (!payload::DecompressResponse(&response)) {
+                fprintf(stderr, "decompress failed at %ld hosts\n", hosts);
+                return 1;
+            }
+            decompress_seconds += bench::NowSeconds() - start;
+        }
+        if (response.metrics_size() != hosts) {
+            fprintf(stderr, "round trip lost metrics at %ld hosts\n", hosts);
+            return 1;
+        }
+
+        response = original;
+        payload::CompressResponse(request, &response, 0);
+        size_t raw = original.ByteSizeLong();
+        size_t packed = response.ByteSizeLong();
+        printf("%8ld %10zu %10zu %6.2fx\n", hosts, raw, packed, static_cast<double>(raw) / packed);
+        // 压缩的耗时包含序列化, 解压的耗时包含反序列化, 和center/TUI里实际多花的一样
+        std::string name = "compress " + std::to_string(hosts) + " hosts";
+        bench::Report(name.c_str(), iterations, compress_seconds);
+        printf("%-40s %10.1f MB/s raw\n", "  throughput", raw * iterations / compress_seconds / 1e6);
+        name = "decompress " + std::to_string(hosts) + " hosts";
+        bench::Report(name.c_str(), iterations, decompress_seconds);
+        printf("%-40s %10.1f MB/s raw\n", "  throughput", raw * iterations / decompress_seconds / 1e6);
+    }
+    return 0;
+}
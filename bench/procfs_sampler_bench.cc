@@ -0,0 +1,42 @@
+// 一次完整采样(CPU, 内存, 每核, loadavg, 磁盘, 网卡)的耗时
+// 用法: procfs_sampler_bench [proc目录, 默认/proc] [次数, 默认20000]
+#include <cstdio>
+#include <string>
+
+#include "bench_util.h"
+#include "procfs_sampler.h"
+
+int main(int argc, char* argv[]) {
+    std::string root = argc > 1 ? argv[1] : "/proc";
+    long iterations = bench::ArgOr(argc, argv, 2, 20000);
+
+    ProcfsSampler sampler(root);
+    if (!sampler.Open()) {
+        fprintf(stderr, "cannot open %s/stat or %s/meminfo\n", root.c_str(), root.c_str());
+        return 1;
+    }
+    ExtendedSample sample;
+    // 预热: 让缓冲区和设备列表长到稳定大小
+    for (int i = 0; i < 10; ++i) {
+        sampler.CpuUsage();
+        sampler.MemoryUsage();
+        sampler.CollectExtended(&sample);
+    }
+
+    double start = bench::NowSeconds();
+    for (long i = 0; i < iterations; ++i) {
+        sampler.CpuUsage();
+        sampler.MemoryUsage();
+    }
+    bench::Report("cpu+memory", iterations, bench::NowSeconds() - start);
+
+    start = bench::NowSeconds();
+    for (long i = 0; i < iterations; ++i) {
+        sampler.CpuUsage();
+        sampler.MemoryUsage();
+        sampler.CollectExtended(&sample);
+    }
+    bench::Report("cpu+memory+extended", iterations, bench::NowSeconds() - start);
+    printf("%zu cores, %zu disks, %zu nets\n", sample.core_usage.size(), sample.disks.size(), sample.nets.size());
+    return 0;
+}
@@ -0,0 +1,86 @@
+// 启动恢复的耗时: 只重放WAL, 以及读快照再重放快照之后的WAL段(和center的RecoverStorage同样的步骤)
+// 用法: recovery_bench [服务器数, 默认1000] [每个服务器的采样数, 默认1200]
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <unistd.h>
+
+#include "bench_util.h"
+#include "metrics_storage.h"
+#include "wal.h"
+
+namespace {
+
+// 恢复到一个新的存储里, 返回重放的WAL记录数
+size_t Recover(const std::string& dir, MetricsStorage* storage) {
+    uint32_t from_seq = 0;
+    std::vector<uint32_t> snapshots = ListSequenceFiles(dir, "snapshot-", ".snap");
+    if (!snapshots.empty() && storage->LoadSnapshot(SequenceFilePath(dir, "snapshot-", snapshots.back(), ".snap")) >= 0) {
+        from_seq = snapshots.back();
+    }
+    WriteAheadLog::ReplayHandler handler;
+    handler.on_register = [storage](uint32_t series_id, const std::string& server_name) {
+        storage->RestoreRegistration(series_id, server_name);
+    };
+    handler.on_sample = [storage](uint32_t series_id, const Sample& sample) { storage->Restore(series_id, sample); };
+    return WriteAheadLog::Replay(dir, from_seq, handler);
+}
+
+// 写入series个服务器各samples条数据, 最后一成数据写在快照之后
+void Populate(const std::string& dir, long series, long samples, bool snapshot) {
+    MetricsStorage storage;
+    WriteAheadLog wal(dir);
+    wal.Open();
+    storage.SetWal(&wal);
+    std::vector<uint32_t> ids;
+    for (long i = 0; i < series; ++i) {
+        ids.push_back(storage.Register("host-" + std::to_string(i)));
+    }
+    dmonitor::MetricsData metrics;
+    long snapshot_at = samples * 9 / 10;
+    for (long s = 0; s < samples; ++s) {
+        if (snapshot && s == snapshot_at) {
+            uint32_t seq = wal.Rotate();
+            storage.SaveSnapshot(SequenceFilePath(dir, "snapshot-", seq, ".snap"));
+            wal.RemoveSegmentsBefore(seq);
+        }
+        for (long i = 0; i < series; ++i) {
+            metrics.set_timestamp(1700000000000LL + s * 3000);
+            metrics.set_cpu_usage(static_cast<float>((s + i) % 100));
+            metrics.set_memory_usage(static_cast<float>(i % 100));
+            storage.AddMetrics(ids[i], metrics);
+        }
+    }
+    wal.Close();
+}
+
+uintmax_t DirBytes(const std::string& dir) {
+    uintmax_t bytes = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+        bytes += entry.file_size();
+    }
+    return bytes;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    long series = bench::ArgOr(argc, argv, 1, 1000);
+    long samples = bench::ArgOr(argc, argv, 2, 1200);
+    std::string base = "/tmp/recovery_bench_" + std::to_string(getpid());
+
+    for (bool snapshot : {false, true}) {
+        std::string dir = base + (snapshot ? "_snap" : "_wal");
+        std::filesystem::remove_all(dir);
+        Populate(dir, series, samples, snapshot);
+
+        MetricsStorage storage;
+        double start = bench::NowSeconds();
+        size_t records = Recover(dir, &storage);
+        double seconds = bench::NowSeconds() - start;
+        printf("%-16s %ld series x %ld samples, %.1f MB on disk: recovered in %.1f ms, %zu WAL records replayed\n",
+               snapshot ? "snapshot+wal" : "wal only", series, samples, DirBytes(dir) / 1e6, seconds * 1e3, records);
+        std::filesystem::remove_all(dir);
+    }
+    return 0;
+}
@@ -0,0 +1,124 @@
+// 分片锁的竞争: 多个线程同时写不同服务器时的总吞吐, 对比所有服务器落在同一个分片上的最坏情况,
+// 以及改分片之前的做法(一把全局锁 + map<名字, deque<MetricsData>>)
+// 用法: shard_contention_bench [每个线程的写入次数, 默认200000] [最多线程数, 默认8]
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bench_util.h"
+#include "metrics_storage.h"
+
+namespace {
+
+constexpr uint32_t SHARDS = 64; // 和MetricsStorage::SHARD_COUNT一致
+constexpr long SERIES_PER_THREAD = 16;
+
+// 改分片之前center里的存储: 所有服务器共用一把锁, 按名字找到历史再追加一条, 最多留20条.
+// 原来每条还要在锁里打一行日志, 这里去掉了, 只比锁和数据结构本身
+class GlobalLockStorage {
+public:
+    void AddMetrics(const dmonitor::MetricsData& metrics) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& history = storage_[metrics.server_name()];
+        history.push_back(metrics);
+        if (history.size() > MAX_HISTORY) {
+            history.pop_front();
+        }
+    }
+
+private:
+    static constexpr size_t MAX_HISTORY = 20;
+    std::map<std::string, std::deque<dmonitor::MetricsData>> storage_;
+    std::mutex mutex_;
+};
+
+// 和Run一样的写入模式, 按名字写进全局锁的存储
+double RunGlobalLock(int threads, long writes) {
+    GlobalLockStorage storage;
+    std::vector<std::string> names;
+    for (long i = 0; i < threads * SERIES_PER_THREAD; ++i) {
+        names.push_back("host-" + std::to_string(i));
+    }
+
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            while (!go.load(std::memory_order_acquire)) {
+            }
+            dmonitor::MetricsData metrics;
+            for (long w = 0; w < writes; ++w) {
+                metrics.set_server_name(names[t * SERIES_PER_THREAD + w % SERIES_PER_THREAD]);
+                metrics.set_timestamp(1700000000000LL + w);
+                metrics.set_cpu_usage(static_cast<float>(w % 100));
+                metrics.set_memory_usage(50.0f);
+                storage.AddMetrics(metrics);
+            }
+        });
+    }
+    double start = bench::NowSeconds();
+    go.store(true, std::memory_order_release);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return threads * writes / (bench::NowSeconds() - start);
+}
+
+// 每个线程轮流写自己的一组服务器, 返回每秒写入条数
+double Run(int threads, long writes, bool same_shard) {
+    MetricsStorage storage;
+    // ID从1开始连续分配, 分片是ID % 64; same_shard时只用ID % 64 == 1的那些
+    std::vector<uint32_t> ids;
+    long needed = threads * SERIES_PER_THREAD;
+    for (long i = 0; static_cast<long>(ids.size()) < needed; ++i) {
+        uint32_t id = storage.Register("host-" + std::to_string(i));
+        if (!same_shard || id % SHARDS == 1) {
+            ids.push_back(id);
+        }
+    }
+
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            while (!go.load(std::memory_order_acquire)) {
+            }
+            dmonitor::MetricsData metrics;
+            for (long w = 0; w < writes; ++w) {
+                uint32_t id = ids[t * SERIES_PER_THREAD + w % SERIES_PER_THREAD];
+                metrics.set_timestamp(1700000000000LL + w);
+                metrics.set_cpu_usage(static_cast<float>(w % 100));
+                metrics.set_memory_usage(50.0f);
+                storage.AddMetrics(id, metrics);
+            }
+        });
+    }
+    double start = bench::NowSeconds();
+    go.store(true, std::memory_order_release);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return threads * writes / (bench::NowSeconds() - start);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    long writes = bench::ArgOr(argc, argv, 1, 200000);
+    int max_threads = static_cast<int>(bench::ArgOr(argc, argv, 2, 8));
+    printf("%u hardware threads\n", std::thread::hardware_concurrency());
+    printf("%8s %20s %20s %20s %10s\n", "threads", "global-lock writes/s", "spread writes/s",
+           "one-shard writes/s", "speedup");
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        double before = RunGlobalLock(threads, writes);
+        double spread = Run(threads, writes, false);
+        double one_shard = Run(threads, writes, true);
+        printf("%8d %20.0f %20.0f %20.0f %9.2fx\n", threads, before, spread, one_shard, spread / before);
+    }
+    return 0;
+}
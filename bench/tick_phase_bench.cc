@@ -0,0 +1,86 @@
+// 一批collector的上报打到center时有多集中: 所有主机对齐到同一边界(同步) vs 按主机名错开相位
+// 不真的起定时器, 按TickScheduler的触发规则算出每台主机在一个上报周期里的到达时间,
+// 统计每毫秒的到达数, 再按center每毫秒能处理的请求数模拟排队
+// 用法: tick_phase_bench [主机数, 默认10000] [上报间隔毫秒, 默认3000] [center每毫秒处理的请求数, 默认20]
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench_util.h"
+#include "tick_scheduler.h"
+
+namespace {
+
+struct Burst {
+    long peak_per_ms = 0;   // 最忙的那一毫秒到了多少个请求
+    long busy_ms = 0;       // 有请求到达的毫秒数
+    long max_queue = 0;     // center积压最多的时候
+    double max_wait_ms = 0; // 最后处理完的请求等了多久
+};
+
+// arrivals[i]是第i台主机在周期内到达的毫秒数; 按每毫秒capacity个请求处理, 先到先处理
+Burst Simulate(const std::vector<long>& arrivals, long interval, long capacity) {
+    std::vector<long> per_ms(interval, 0);
+    for (long at : arrivals) {
+        ++per_ms[at % interval];
+    }
+    Burst burst;
+    // 跑两个周期, 第一个周期剩下的积压会带到第二个周期
+    long queue = 0;
+    for (long round = 0; round < 2; ++round) {
+        for (long ms = 0; ms < interval; ++ms) {
+            queue += per_ms[ms];
+            burst.max_queue = std::max(burst.max_queue, queue);
+            burst.max_wait_ms = std::max(burst.max_wait_ms, static_cast<double>(queue) / capacity);
+            queue = std::max(0L, queue - capacity);
+        }
+    }
+    for (long count : per_ms) {
+        burst.peak_per_ms = std::max(burst.peak_per_ms, count);
+        burst.busy_ms += count > 0 ? 1 : 0;
+    }
+    return burst;
+}
+
+void Print(const char* name, const Burst& burst, long hosts, long interval) {
+    printf("%-12s peak %6ld req/ms (mean %.2f)  busy %5ld/%ld ms  max queue %6ld  max wait %8.1f ms\n",
+           name, burst.peak_per_ms, static_cast<double>(hosts) / interval, burst.busy_ms, interval,
+           burst.max_queue, burst.max_wait_ms);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    long hosts = bench::ArgOr(argc, argv, 1, 10000);
+    long interval = bench::ArgOr(argc, argv, 2, 3000);
+    long capacity = bench::ArgOr(argc, argv, 3, 20);
+
+    // 各主机的时钟靠NTP同步, 相互差几毫秒; 两种方式都带上这点误差
+    std::mt19937 random(42);
+    std::uniform_int_distribution<long> skew(0, 5);
+    std::vector<std::string> names;
+    names.reserve(hosts);
+    for (long i = 0; i < hosts; ++i) {
+        names.push_back("web-" + std::to_string(i) + ".prod");
+    }
+
+    std::vector<long> synchronized(hosts);
+    for (long i = 0; i < hosts; ++i) {
+        synchronized[i] = skew(random);
+    }
+
+    std::vector<long> phased(hosts);
+    double start = bench::NowSeconds();
+    for (long i = 0; i < hosts; ++i) {
+        phased[i] = TickScheduler::HostPhase(names[i], std::chrono::milliseconds(interval)).count() + skew(random);
+    }
+    bench::Report("HostPhase", hosts, bench::NowSeconds() - start);
+
+    printf("%ld hosts, %ld ms interval, center handles %ld req/ms\n", hosts, interval, capacity);
+    Print("synchronized", Simulate(synchronized, interval, capacity), hosts, interval);
+    Print("phased", Simulate(phased, interval, capacity), hosts, interval);
+    return 0;
+}
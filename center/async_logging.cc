@@ -0,0 +1,232 @@
+#include "async_logging.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdarg>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+namespace {
+
+const char* SeverityName(LogSeverity level) {
+    switch (level) {
+    case LogSeverity::DEBUG: return "DEBUG";
+    case LogSeverity::INFO:  return "INFO ";
+    case LogSeverity::WARN:  return "WARN ";
+    case LogSeverity::ERROR: return "ERROR";
+    }
+    return "?    ";
+}
+
+const char* BaseName(const char* file) {
+    const char* slash = strrchr(file, '/');
+    return slash != nullptr ? slash + 1 : file;
+}
+
+int64_t NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+}
+
+// 行首时间戳, 秒级部分按线程缓存, 同一秒内不再调localtime_r
+void AppendTime(std::string& out) {
+    thread_local time_t cached_sec = 0;
+    thread_local char sec_buf[32];
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    if (tv.tv_sec != cached_sec) {
+        struct tm tm_time;
+        localtime_r(&tv.tv_sec, &tm_time);
+        strftime(sec_buf, sizeof(sec_buf), "%Y-%m-%d %H:%M:%S", &tm_time);
+        cached_sec = tv.tv_sec;
+    }
+    char ms_buf[8];
+    snprintf(ms_buf, sizeof(ms_buf), ".%03d ", static_cast<int>(tv.tv_usec / 1000));
+    out.append(sec_buf);
+    out.append(ms_buf);
+}
+
+void WriteAll(int fd, const std::string& data) {
+    const char* ptr = data.data();
+    size_t left = data.size();
+    while (left > 0) {
+        ssize_t n = write(fd, ptr, left);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        ptr += n;
+        left -= n;
+    }
+}
+
+} // namespace
+
+AsyncLogger& AsyncLogger::Instance() {
+    static AsyncLogger logger;
+    return logger;
+}
+
+AsyncLogger::AsyncLogger() {
+    flusher_ = std::thread(&AsyncLogger::FlusherThread, this);
+}
+
+AsyncLogger::~AsyncLogger() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cond_.notify_one();
+    if (flusher_.joinable()) {
+        flusher_.join();
+    }
+    Flush();
+    if (fd_ > 2) {
+        close(fd_);
+    }
+}
+
+bool AsyncLogger::SetOutput(const std::string& path) {
+    int fd = 1;
+    if (!path.empty()) {
+        fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            return false;
+        }
+    }
+    std::lock_guard<std::mutex> lock(flush_mutex_);
+    FlushLocked();
+    if (fd_ > 2) {
+        close(fd_);
+    }
+    fd_ = fd;
+    return true;
+}
+
+AsyncLogger::ThreadBuffer& AsyncLogger::LocalBuffer() {
+    // 线程退出后缓冲区还留在buffers_里, 由后台线程写完再回收
+    thread_local std::shared_ptr<ThreadBuffer> buffer;
+    if (buffer == nullptr) {
+        buffer = std::make_shared<ThreadBuffer>();
+        std::lock_guard<std::mutex> lock(buffers_mutex_);
+        buffers_.push_back(buffer);
+    }
+    return *buffer;
+}
+
+void AsyncLogger::Logf(LogSeverity level, const char* file, int line, const char* fmt, ...) {
+    // 绝大多数日志放得进栈上的缓冲区; 放不下的(比如多行的状态汇总)再按实际长度格式化一次, 不截断
+    char buf[1024];
+    va_list args;
+    va_start(args, fmt);
+    va_list retry;
+    va_copy(retry, args);
+    int n = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    if (n >= 0 && static_cast<size_t>(n) < sizeof(buf)) {
+        Log(level, file, line, buf, n);
+    } else if (n >= 0) {
+        std::string long_buf(n + 1, '\0');
+        vsnprintf(&long_buf[0], long_buf.size(), fmt, retry);
+        Log(level, file, line, long_buf.data(), n);
+    }
+    va_end(retry);
+}
+
+void AsyncLogger::Log(LogSeverity level, const char* file, int line, const char* msg, size_t len) {
+    ThreadBuffer& buffer = LocalBuffer();
+    {
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        if (buffer.data.size() >= MAX_BUFFER_BYTES) {
+            ++buffer.dropped;
+            return;
+        }
+        AppendTime(buffer.data);
+        buffer.data.append(SeverityName(level));
+        buffer.data.push_back(' ');
+        if (file != nullptr) {
+            buffer.data.append(BaseName(file));
+            buffer.data.push_back(':');
+            buffer.data.append(std::to_string(line));
+            buffer.data.push_back(' ');
+        }
+        buffer.data.append(msg, len);
+        if (len == 0 || msg[len - 1] != '\n') {
+            buffer.data.push_back('\n');
+        }
+    }
+    // 错误日志尽快落盘
+    if (level == LogSeverity::ERROR) {
+        cond_.notify_one();
+    }
+}
+
+void AsyncLogger::Flush() {
+    std::lock_guard<std::mutex> lock(flush_mutex_);
+    FlushLocked();
+}
+
+void AsyncLogger::FlushLocked() {
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(buffers_mutex_);
+        buffers = buffers_;
+    }
+    batch_.clear();
+    for (const auto& buffer : buffers) {
+        uint64_t dropped;
+        {
+            // 双缓冲: 锁内只交换字符串, 写线程马上拿到一块空的(保留了容量的)缓冲区
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            spare_.clear();
+            buffer->data.swap(spare_);
+            dropped = buffer->dropped;
+            buffer->dropped = 0;
+        }
+        batch_.append(spare_);
+        if (dropped > 0) {
+            batch_.append("log buffer full, dropped " + std::to_string(dropped) + " lines\n");
+        }
+    }
+    if (!batch_.empty()) {
+        WriteAll(fd_, batch_);
+    }
+    buffers.clear();
+
+    // 只剩列表里一个引用说明线程已经退出, 最后一批也写完了, 回收它的缓冲区
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    buffers_.erase(std::remove_if(buffers_.begin(), buffers_.end(),
+                                  [](const std::shared_ptr<ThreadBuffer>& buffer) {
+                                      return buffer.use_count() == 1 && buffer->data.empty();
+                                  }),
+                   buffers_.end());
+}
+
+void AsyncLogger::FlusherThread() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        cond_.wait_for(lock, std::chrono::milliseconds(FLUSH_INTERVAL_MS));
+        lock.unlock();
+        Flush();
+        lock.lock();
+    }
+}
+
+bool LogRateLimiter::Allow(int64_t interval_ms, uint64_t* suppressed) {
+    int64_t now = NowMs();
+    int64_t next = next_ms_.load(std::memory_order_relaxed);
+    // 多个线程同时到期时只有一个能抢到这个时间窗
+    if (now < next || !next_ms_.compare_exchange_strong(next, now + interval_ms, std::memory_order_relaxed)) {
+        suppressed_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    *suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+    return true;
+}
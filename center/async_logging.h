@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+enum class LogSeverity {
+    DEBUG,
+    INFO,
+    WARN,
+    ERROR,
+};
+
+// 异步日志
+// 每个线程往自己的缓冲区里追加格式化好的日志行, 只锁自己的(几乎无竞争的)互斥量;
+// 后台线程每FLUSH_INTERVAL_MS把各线程的缓冲区换出来(双缓冲), 合成一次write写出去.
+// 级别在格式化之前判断, 关掉的级别只花一次原子读.
+class AsyncLogger {
+public:
+    static constexpr int FLUSH_INTERVAL_MS = 100;
+    static constexpr size_t MAX_BUFFER_BYTES = 4 * 1024 * 1024; // 单个线程积压超过这个数就丢弃新日志
+
+    static AsyncLogger& Instance();
+
+    // 输出到文件(追加), 空字符串表示标准输出. 启动阶段调用
+    bool SetOutput(const std::string& path);
+    void SetLevel(LogSeverity level) { level_.store(static_cast<int>(level), std::memory_order_relaxed); }
+    bool Enabled(LogSeverity level) const {
+        return static_cast<int>(level) >= level_.load(std::memory_order_relaxed);
+    }
+
+    // 调用前应该已经用Enabled判断过级别, 一般通过下面的ALOG宏调用
+    void Logf(LogSeverity level, const char* file, int line, const char* fmt, ...)
+        __attribute__((format(printf, 5, 6)));
+    // 追加一条已经格式化好的消息
+    void Log(LogSeverity level, const char* file, int line, const char* msg, size_t len);
+    // 同步写出所有线程已经积压的日志
+    void Flush();
+
+    ~AsyncLogger();
+
+private:
+    struct ThreadBuffer {
+        std::mutex mutex;
+        std::string data;
+        uint64_t dropped = 0;
+    };
+
+    AsyncLogger();
+    ThreadBuffer& LocalBuffer();
+    void FlusherThread();
+    // 调用方持有flush_mutex_
+    void FlushLocked();
+
+    std::atomic<int> level_{static_cast<int>(LogSeverity::INFO)};
+
+    std::mutex buffers_mutex_; // 保护buffers_列表本身
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+
+    std::mutex flush_mutex_; // 保证同一时刻只有一个线程在写fd_
+    std::string spare_;
+    std::string batch_;
+    int fd_ = 1;
+
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    bool running_ = true;
+    std::thread flusher_;
+};
+
+// 每个调用点一个限速器: 间隔内只放行第一条, 其余的计数, 下次放行时一起报出来
+class LogRateLimiter {
+public:
+    // 放行时把期间被压掉的条数写到suppressed
+    bool Allow(int64_t interval_ms, uint64_t* suppressed);
+
+private:
+    std::atomic<int64_t> next_ms_{0};
+    std::atomic<uint64_t> suppressed_{0};
+};
+
+// ALOG(INFO, "stored %d records", n)
+#define ALOG(severity, fmt, ...)                                                              \
+    do {                                                                                      \
+        AsyncLogger& alog_logger = AsyncLogger::Instance();                                   \
+        if (alog_logger.Enabled(LogSeverity::severity)) {                                     \
+            alog_logger.Logf(LogSeverity::severity, __FILE__, __LINE__, fmt, ##__VA_ARGS__);  \
+        }                                                                                     \
+    } while (0)
+
+// 限速版本: 同一个调用点每interval_ms最多打一条, 用在每个请求都会走到的路径上
+#define ALOG_EVERY_MS(severity, interval_ms, fmt, ...)                                        \
+    do {                                                                                      \
+        static LogRateLimiter alog_limiter;                                                   \
+        uint64_t alog_suppressed;                                                             \
+        AsyncLogger& alog_logger = AsyncLogger::Instance();                                   \
+        if (alog_logger.Enabled(LogSeverity::severity) &&                                     \
+            alog_limiter.Allow(interval_ms, &alog_suppressed)) {                              \
+            alog_logger.Logf(LogSeverity::severity, __FILE__, __LINE__, fmt " (%llu suppressed)", \
+                             ##__VA_ARGS__, static_cast<unsigned long long>(alog_suppressed)); \
+        }                                                                                     \
+    } while (0)
@@ -0,0 +1,23 @@
+#include "batch_decode.h"
+
+bool DecodeBatch(const dmonitor::ReportBatchRequest& request, std::vector<Sample>* samples) {
+    int count = request.timestamp_deltas_size();
+    if (request.cpu_deltas_size() != count || request.memory_deltas_size() != count) {
+        return false;
+    }
+    // 累加用int64: 每一步都检查范围, cpu和memory加上一个int32的差分不会溢出
+    int64_t timestamp = 0;
+    int64_t cpu = 0, memory = 0;
+    for (int i = 0; i < count; ++i) {
+        if (__builtin_add_overflow(timestamp, request.timestamp_deltas(i), &timestamp) || timestamp <= 0) {
+            return false;
+        }
+        cpu += request.cpu_deltas(i);
+        memory += request.memory_deltas(i);
+        if (cpu < 0 || cpu > MAX_USAGE_HUNDREDTHS || memory < 0 || memory > MAX_USAGE_HUNDREDTHS) {
+            return false;
+        }
+        samples->push_back({timestamp, cpu / 100.0f, memory / 100.0f});
+    }
+    return true;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <vector>
+
+#include "gorilla.h"
+#include "monitor.pb.h"
+
+// 使用率在批量上报里按百分比×100取整, 合法范围是0~100%
+constexpr int64_t MAX_USAGE_HUNDREDTHS = 10000;
+
+// 还原ReportBatchRequest里的差分编码, 结果追加到samples(调用方先清空, 可以复用).
+// 差分来自网络, 不可信: 三个数组长度不一致、时间戳溢出或不为正、使用率超出0~100%时返回false,
+// 这时samples里的内容不能用
+bool DecodeBatch(const dmonitor::ReportBatchRequest& request, std::vector<Sample>* samples);
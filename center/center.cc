@@ -1,114 +1,81 @@
-#include <iostream>
-#include <map>
-#include <deque>
-#include <mutex>
+#include <vector>
+#include <memory>
+#include <algorithm>
 #include <thread>
 #include <chrono>
+#include <mutex>
+#include <unistd.h>
+#include <google/protobuf/unknown_field_set.h>
 #include "Krpcapplication.h"
 #include "Krpcprovider.h"
 #include "monitor.pb.h"
-
-// 数据存储管理类
-class MetricsStorage {
-private:
-    // 每个服务器保存最近20条记录
-    std::map<std::string, std::deque<dmonitor::MetricsData>> storage_;
-    std::mutex mutex_;
-    const size_t MAX_HISTORY = 20;
-    const int64_t OFFLINE_THRESHOLD_MS = 10000; // 10秒未上报视为离线
-
-public:
-    // 添加监控数据
-    void AddMetrics(const dmonitor::MetricsData& metrics) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        
-        std::string server_name = metrics.server_name();
-        auto& history = storage_[server_name];
-        
-        // 添加新数据
-        history.push_back(metrics);
-        
-        // 保持最多20条记录
-        if (history.size() > MAX_HISTORY) {
-            history.pop_front();
-        }
-        
-        std::cout << "[" << metrics.timestamp() << "] Stored metrics from " 
-                  << server_name << ": CPU=" << metrics.cpu_usage() 
-                  << "%, Memory=" << metrics.memory_usage() << "%" << std::endl;
-    }
-    
-    // 查询监控数据（空字符串表示查询所有服务器）
-    std::vector<dmonitor::MetricsData> QueryMetrics(const std::string& server_name) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        std::vector<dmonitor::MetricsData> result;
-        
-        int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now().time_since_epoch()
-        ).count();
-        
-        if (server_name.empty()) {
-            // 查询所有服务器的最新数据
-            for (const auto& pair : storage_) {
-                if (!pair.second.empty()) {
-                    dmonitor::MetricsData data = pair.second.back();
-                    // 检查是否离线
-                    if (now - data.timestamp() > OFFLINE_THRESHOLD_MS) {
-                        // 标记为离线（CPU和内存使用率设为-1）
-                        data.set_cpu_usage(-1.0);
-                        data.set_memory_usage(-1.0);
-                    }
-                    result.push_back(data);
-                }
-            }
-        } else {
-            // 查询指定服务器的所有历史记录
-            auto it = storage_.find(server_name);
-            if (it != storage_.end()) {
-                for (const auto& data : it->second) {
-                    result.push_back(data);
-                }
-            }
-        }
-        
-        return result;
-    }
-    
-    // 获取所有服务器的在线状态
-    void PrintStatus() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        
-        int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now().time_since_epoch()
-        ).count();
-        
-        std::cout << "\n=== Server Status ===" << std::endl;
-        for (const auto& pair : storage_) {
-            if (!pair.second.empty()) {
-                const auto& latest = pair.second.back();
-                int64_t elapsed = now - latest.timestamp();
-                std::string status = (elapsed > OFFLINE_THRESHOLD_MS) ? "OFFLINE" : "ONLINE";
-                std::cout << pair.first << ": " << status 
-                          << " (last seen " << elapsed / 1000 << "s ago)" << std::endl;
-            }
-        }
-        std::cout << "=====================\n" << std::endl;
-    }
-};
+#include "metrics_storage.h"
+#include "wal.h"
+#include "downsample.h"
+#include "async_logging.h"
+#include "batch_decode.h"
+#include "payload_codec.h"
 
 // 全局数据存储
 MetricsStorage g_storage;
 
+int64_t NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+}
+
 class MonitorReportService : public dmonitor::MonitorReportServiceRpc 
 {
 public:
+    void Register(::google::protobuf::RpcController* controller,
+        const ::dmonitor::RegisterRequest* request,
+        ::dmonitor::RegisterResponse* response,
+        ::google::protobuf::Closure* done)
+    {
+        uint32_t series_id = request->server_name().empty() ? 0 : g_storage.Register(request->server_name());
+        if (series_id == 0) {
+            response->mutable_result()->set_errcode(1);
+            response->mutable_result()->set_errmsg("register failed");
+            response->set_success(false);
+        } else {
+            ALOG(INFO, "Registered %s as series %u", request->server_name().c_str(), series_id);
+            response->set_series_id(series_id);
+            response->set_incarnation(g_storage.incarnation());
+            response->mutable_result()->set_errcode(0);
+            response->mutable_result()->set_errmsg("");
+            response->set_success(true);
+        }
+        done->Run();
+    }
+
     void Report(::google::protobuf::RpcController* controller,
         const ::dmonitor::ReportRequest* request,
         ::dmonitor::ReportResponse* response,
         ::google::protobuf::Closure* done)
     {
-        // 存储监控数据
-        g_storage.AddMetrics(request->metrics());
+        // 存储监控数据: 带ID的按ID写, 不用再哈希服务器名; 没带ID的是老collector, 按名字写
+        if (request->series_id() != 0) {
+            // center重启过或ID不认识, 让collector重新注册
+            if (request->incarnation() != g_storage.incarnation() ||
+                !g_storage.HasSeries(request->series_id())) {
+                response->mutable_result()->set_errcode(2);
+                response->mutable_result()->set_errmsg("unknown series, register again");
+                response->set_success(false);
+                done->Run();
+                return;
+            }
+            g_storage.AddMetrics(request->series_id(), request->metrics());
+        } else if (request->metrics().server_name().empty()) {
+            // 和Register一样, 不为空名字建序列
+            response->mutable_result()->set_errcode(1);
+            response->mutable_result()->set_errmsg("empty server name");
+            response->set_success(false);
+            done->Run();
+            return;
+        } else {
+            g_storage.AddMetrics(request->metrics());
+        }
         
         // 构造响应
         response->mutable_result()->set_errcode(0);
@@ -118,51 +85,326 @@ public:
         // 执行回调
         done->Run();
     }
+
+    // 高频采样的批量上报: 还原差分编码后整批一次写入存储
+    void ReportBatch(::google::protobuf::RpcController* controller,
+        const ::dmonitor::ReportBatchRequest* request,
+        ::dmonitor::ReportResponse* response,
+        ::google::protobuf::Closure* done)
+    {
+        uint32_t series_id = request->series_id();
+        if (series_id != 0 && (request->incarnation() != g_storage.incarnation() ||
+                               !g_storage.HasSeries(series_id))) {
+            response->mutable_result()->set_errcode(2);
+            response->mutable_result()->set_errmsg("unknown series, register again");
+            response->set_success(false);
+            done->Run();
+            return;
+        }
+        if (series_id == 0 && !request->server_name().empty()) {
+            series_id = g_storage.Register(request->server_name());
+        }
+        // 每个IO线程复用自己的解码缓冲区, 稳定后不再分配
+        thread_local std::vector<Sample> samples;
+        samples.clear();
+        if (series_id == 0 || !DecodeBatch(*request, &samples)) {
+            response->mutable_result()->set_errcode(1);
+            response->mutable_result()->set_errmsg("bad batch");
+            response->set_success(false);
+            done->Run();
+            return;
+        }
+        const dmonitor::MetricsData* extended = request->has_extended() ? &request->extended() : nullptr;
+        g_storage.AddBatch(series_id, &samples, extended);
+        // 死区模式下没变化的点没有上报, 最新值一直有效到sampled_until; 心跳的扩展指标打在sampled_until上
+        if (request->sampled_until() != 0) {
+            g_storage.Touch(series_id, request->sampled_until(), extended);
+        }
+
+        response->mutable_result()->set_errcode(0);
+        response->mutable_result()->set_errmsg("");
+        response->set_success(true);
+        done->Run();
+    }
 };
 
 class MonitorQueryService : public dmonitor::MonitorQueryServiceRpc
 {
 public:
+    // 序列化后不小于compress_min_bytes的响应, 客户端接受时压缩发送
+    explicit MonitorQueryService(size_t compress_min_bytes) : compress_min_bytes_(compress_min_bytes) {}
+
     void Query(::google::protobuf::RpcController* controller,
         const ::dmonitor::QueryRequest* request,
         ::dmonitor::QueryResponse* response,
         ::google::protobuf::Closure* done)
     {
         std::string server_name = request->server_name();
-        std::cout << "Query request for: " << (server_name.empty() ? "ALL" : server_name) << std::endl;
         
-        // 查询数据
-        std::vector<dmonitor::MetricsData> metrics = g_storage.QueryMetrics(server_name);
+        size_t count = 0;
+        bool packed = false;
+        if (server_name.empty()) {
+            // 所有服务器的概览: 同一纪元内直接复用已经编码好的字节
+            std::shared_ptr<const OverviewCache> cache = GetOverview();
+            count = cache->fields.field_count();
+            // 接受压缩的客户端直接拿这一纪元压缩好的整个响应, 同一纪元内只压缩一次
+            if (payload::Accepts(*request, dmonitor::CODEC_ZLIB) && !cache->Packed(compress_min_bytes_).empty()) {
+                response->set_codec(dmonitor::CODEC_ZLIB);
+                response->set_raw_size(cache->raw_size);
+                response->set_compressed(cache->packed);
+                packed = true;
+            } else {
+                response->GetReflection()->MutableUnknownFields(response)->MergeFrom(cache->fields);
+            }
+        } else {
+            // 直接填进响应, 不再先放进临时的vector再逐条拷贝
+            g_storage.QueryMetrics(server_name, response->mutable_metrics());
+            count = response->metrics_size();
+        }
         
-        // 填充响应
-        for (const auto& data : metrics) {
-            dmonitor::MetricsData* metrics_ptr = response->add_metrics();
-            metrics_ptr->CopyFrom(data);
+        if (!packed) {
+            response->mutable_result()->set_errcode(0);
+            response->mutable_result()->set_errmsg("");
+            response->set_success(true);
+            payload::CompressResponse(*request, response, compress_min_bytes_);
         }
         
+        // 每个请求都会走到, 限速打印, 不然日志本身就成了瓶颈
+        ALOG_EVERY_MS(INFO, 1000, "Query for %s returned %zu records",
+                      server_name.empty() ? "ALL" : server_name.c_str(), count);
+        
+        // 执行回调
+        done->Run();
+    }
+
+    // 时间范围查询: 步长不小于最细的汇总桶时直接用预聚合的桶, 否则解码原始数据再分桶,
+    // 返回的点数只取决于max_points, 和保留了多久的历史无关
+    void QueryRange(::google::protobuf::RpcController* controller,
+        const ::dmonitor::RangeQueryRequest* request,
+        ::dmonitor::RangeQueryResponse* response,
+        ::google::protobuf::Closure* done)
+    {
+        const std::string& server_name = request->server_name();
+        int64_t end = request->end_time() > 0 ? request->end_time() : NowMs();
+        int64_t start = request->start_time() > 0 ? request->start_time() : end - 3600 * 1000;
+        if (server_name.empty() || start > end) {
+            response->mutable_result()->set_errcode(1);
+            response->mutable_result()->set_errmsg("invalid range query");
+            response->set_success(false);
+            done->Run();
+            return;
+        }
+
+        int64_t step = std::max<int64_t>(request->step(), 0);
+        if (request->max_points() > 0) {
+            // 步长至少要让点数不超过max_points
+            int64_t min_step = (end - start + request->max_points()) / request->max_points();
+            step = std::max(step, min_step);
+        }
+
+        std::vector<RollupBucket> buckets;
+        int64_t width = 0;
+        if (step > 0 && g_storage.QueryRollup(server_name, start, end, step, &buckets, &width)) {
+            // 预聚合的桶宽不一定正好等于step, 再按step合并一次
+            if (width < step) {
+                buckets = MergeBuckets(buckets, start, step);
+                width = step;
+            }
+        } else {
+            buckets = BucketizeSamples(g_storage.QueryRange(server_name, start, end), start, step);
+            width = step;
+        }
+
+        response->mutable_points()->Reserve(static_cast<int>(buckets.size()));
+        for (const auto& bucket : buckets) {
+            dmonitor::RangePoint* point = response->add_points();
+            point->set_timestamp(bucket.start);
+            point->set_cpu_usage(bucket.cpu_sum / bucket.count);
+            point->set_memory_usage(bucket.mem_sum / bucket.count);
+            point->set_cpu_min(bucket.cpu_min);
+            point->set_cpu_max(bucket.cpu_max);
+            point->set_memory_min(bucket.mem_min);
+            point->set_memory_max(bucket.mem_max);
+        }
+        response->set_step(width);
         response->mutable_result()->set_errcode(0);
         response->mutable_result()->set_errmsg("");
         response->set_success(true);
-        
-        std::cout << "Returned " << metrics.size() << " records" << std::endl;
-        
-        // 执行回调
+        payload::CompressResponse(*request, response, compress_min_bytes_);
+
         done->Run();
     }
+
+private:
+    // 编码好的概览: 每个服务器一条, 作为QueryResponse.metrics(字段1)的未知字段保存,
+    // 合并进响应后序列化时原样拷贝字节, 客户端解析出来就是普通的metrics
+    struct OverviewCache {
+        uint64_t epoch = 0;
+        google::protobuf::UnknownFieldSet fields;
+        // 整个成功响应压缩后的字节, 第一个接受压缩的查询才生成; 不到min_bytes或压不小时为空
+        mutable std::once_flag pack_once;
+        mutable std::string packed;
+        mutable uint32_t raw_size = 0;
+
+        const std::string& Packed(size_t min_bytes) const
+        {
+            std::call_once(pack_once, [this, min_bytes] {
+                dmonitor::QueryResponse response;
+                response.GetReflection()->MutableUnknownFields(&response)->MergeFrom(fields);
+                response.mutable_result()->set_errcode(0);
+                response.mutable_result()->set_errmsg("");
+                response.set_success(true);
+                std::string raw = response.SerializeAsString();
+                if (raw.size() >= min_bytes && payload::Compress(raw, &packed)) {
+                    raw_size = static_cast<uint32_t>(raw.size());
+                }
+            });
+            return packed;
+        }
+    };
+
+    std::shared_ptr<const OverviewCache> GetOverview()
+    {
+        uint64_t epoch = g_storage.ChangeEpoch();
+        std::lock_guard<std::mutex> lock(overview_mutex_);
+        if (overview_ == nullptr || overview_->epoch < epoch) {
+            // 纪元推进了才重新查询和编码, 同一纪元内并发的查询只有一个会走到这里
+            auto cache = std::make_shared<OverviewCache>();
+            cache->epoch = epoch;
+            // scratch_在锁内复用, 每个服务器的MetricsData对象和名字缓冲区在多次重建之间不再重新分配
+            g_storage.QueryMetrics("", &overview_scratch_);
+            for (const auto& data : overview_scratch_) {
+                data.SerializeToString(cache->fields.AddLengthDelimited(
+                    dmonitor::QueryResponse::kMetricsFieldNumber));
+            }
+            overview_ = std::move(cache);
+        }
+        return overview_;
+    }
+
+    const size_t compress_min_bytes_;
+    std::mutex overview_mutex_;
+    std::shared_ptr<const OverviewCache> overview_;
+    google::protobuf::RepeatedPtrField<dmonitor::MetricsData> overview_scratch_;
 };
 
 // 状态监控线程
 void StatusMonitorThread() {
+    // 每秒刷新一次在线状态, 查询时直接读; 每30秒打印一次状态
+    for (int tick = 1; ; ++tick) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        g_storage.SweepOffline();
+        if (tick % 30 == 0) {
+            g_storage.PrintStatus();
+        }
+    }
+}
+
+// 启动时恢复数据: 读入最新的快照, 再重放快照之后的WAL段
+void RecoverStorage(const std::string& data_dir) {
+    auto start = std::chrono::steady_clock::now();
+
+    uint32_t from_seq = 0;
+    long series = 0;
+    std::vector<uint32_t> snapshots = ListSequenceFiles(data_dir, "snapshot-", ".snap");
+    for (auto it = snapshots.rbegin(); it != snapshots.rend(); ++it) {
+        // 快照snapshot-N包含了序号小于N的所有WAL段
+        series = g_storage.LoadSnapshot(SequenceFilePath(data_dir, "snapshot-", *it, ".snap"));
+        if (series >= 0) {
+            from_seq = *it;
+            break;
+        }
+    }
+    WriteAheadLog::ReplayHandler handler;
+    handler.on_register = [](uint32_t series_id, const std::string& server_name) {
+        g_storage.RestoreRegistration(series_id, server_name);
+    };
+    handler.on_sample = [](uint32_t series_id, const Sample& sample) {
+        g_storage.Restore(series_id, sample);
+    };
+    size_t records = WriteAheadLog::Replay(data_dir, from_seq, handler);
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    ALOG(INFO, "Recovery finished: %ld series from snapshot, %zu WAL records replayed in %ld ms",
+         std::max(series, 0L), records, static_cast<long>(elapsed));
+}
+
+// 快照线程: 定期切WAL段并写快照, 成功后删掉已经被快照覆盖的WAL段和旧快照
+void SnapshotThread(std::string data_dir, WriteAheadLog* wal, int interval_sec) {
     while (true) {
-        std::this_thread::sleep_for(std::chrono::seconds(30));
-        g_storage.PrintStatus();
+        std::this_thread::sleep_for(std::chrono::seconds(interval_sec));
+
+        auto start = std::chrono::steady_clock::now();
+        uint32_t seq = wal->Rotate();
+        if (!g_storage.SaveSnapshot(SequenceFilePath(data_dir, "snapshot-", seq, ".snap"))) {
+            continue;
+        }
+        wal->RemoveSegmentsBefore(seq);
+        for (uint32_t old : ListSequenceFiles(data_dir, "snapshot-", ".snap")) {
+            if (old < seq) {
+                unlink(SequenceFilePath(data_dir, "snapshot-", old, ".snap").c_str());
+            }
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        ALOG(INFO, "Snapshot %u written in %ld ms", seq, static_cast<long>(elapsed));
     }
 }
 
 int main(int argc, char* argv[]) 
 {
-    std::cout << "Monitor Center Starting..." << std::endl;
+    ALOG(INFO, "Monitor Center Starting...");
     KrpcApplication::Init(argc, argv);
+
+    // 日志: 级别(debug/info/warn/error)和输出文件, 没配置文件就输出到标准输出
+    std::string log_file = KrpcApplication::GetConfig().Load("logfile");
+    if (!log_file.empty() && !AsyncLogger::Instance().SetOutput(log_file)) {
+        ALOG(ERROR, "Cannot open log file %s", log_file.c_str());
+    }
+    std::string log_level = KrpcApplication::GetConfig().Load("loglevel");
+    if (log_level == "debug") {
+        AsyncLogger::Instance().SetLevel(LogSeverity::DEBUG);
+    } else if (log_level == "warn" || log_level == "error") {
+        AsyncLogger::Instance().SetLevel(log_level == "warn" ? LogSeverity::WARN : LogSeverity::ERROR);
+    }
+
+    // 每个服务器保留多少条历史, 配置文件里没有就用默认值
+    std::string capacity = KrpcApplication::GetConfig().Load("historycapacity");
+    if (!capacity.empty()) {
+        g_storage.SetHistoryCapacity(std::stoul(capacity));
+    }
+    // 容器指标每个服务器保留多少条, 容器多时这部分最占内存
+    std::string container_capacity = KrpcApplication::GetConfig().Load("containerhistory");
+    if (!container_capacity.empty()) {
+        g_storage.SetContainerHistoryCapacity(std::stoul(container_capacity));
+    }
+    // 压缩历史保留多少小时
+    std::string retention = KrpcApplication::GetConfig().Load("retentionhours");
+    if (!retention.empty()) {
+        g_storage.SetRetention(std::stoll(retention) * 3600 * 1000);
+    }
+
+    // 最多容纳多少个服务器, 序列表启动时一次分配好
+    std::string max_series = KrpcApplication::GetConfig().Load("maxseries");
+    if (!max_series.empty()) {
+        g_storage.SetMaxSeries(std::stoul(max_series));
+    }
+
+    // 配置了datadir才开启WAL和快照, 否则数据只在内存里
+    std::string data_dir = KrpcApplication::GetConfig().Load("datadir");
+    std::unique_ptr<WriteAheadLog> wal;
+    if (!data_dir.empty()) {
+        RecoverStorage(data_dir);
+        wal = std::make_unique<WriteAheadLog>(data_dir);
+        if (wal->Open()) {
+            g_storage.SetWal(wal.get());
+            std::string interval = KrpcApplication::GetConfig().Load("snapshotintervalsec");
+            std::thread snapshot_thread(SnapshotThread, data_dir, wal.get(),
+                                        interval.empty() ? 600 : std::stoi(interval));
+            snapshot_thread.detach();
+        }
+    }
     
     // 启动状态监控线程
     std::thread status_thread(StatusMonitorThread);
@@ -170,9 +412,12 @@ int main(int argc, char* argv[])
     
     KrpcProvider provider;
     provider.NotifyService(new MonitorReportService());
-    provider.NotifyService(new MonitorQueryService());
+    // 查询响应压缩的阈值(字节), 0表示只要客户端接受就压缩
+    std::string compress_min = KrpcApplication::GetConfig().Load("compressminbytes");
+    provider.NotifyService(new MonitorQueryService(
+        compress_min.empty() ? payload::DEFAULT_MIN_BYTES : std::stoul(compress_min)));
     
-    std::cout << "Center is running..." << std::endl;
+    ALOG(INFO, "Center is running...");
     provider.Run();
     
     return 0;
@@ -0,0 +1,94 @@
+#include "columns.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+const float MISSING = std::numeric_limits<float>::quiet_NaN();
+
+} // namespace
+
+void ColumnStore::BeginRow(int64_t timestamp) {
+    if (timestamps_.size() < capacity_) {
+        current_ = timestamps_.size();
+        timestamps_.push_back(timestamp);
+        for (auto& column : columns_) {
+            column.values.push_back(MISSING);
+        }
+    } else {
+        current_ = head_;
+        head_ = (head_ + 1) % timestamps_.size();
+        if (head_ == 0) {
+            DropEmptyColumns();
+        }
+        timestamps_[current_] = timestamp;
+        for (auto& column : columns_) {
+            column.values[current_] = MISSING;
+        }
+    }
+    cursor_ = 0;
+}
+
+void ColumnStore::DropEmptyColumns() {
+    // 在覆盖current_这一行之前检查, 这一行的旧值也算; 每capacity行才做一次, 均摊下来每行O(列数)
+    auto empty = [](const Column& column) {
+        return std::all_of(column.values.begin(), column.values.end(), [](float v) { return std::isnan(v); });
+    };
+    columns_.erase(std::remove_if(columns_.begin(), columns_.end(), empty), columns_.end());
+}
+
+size_t ColumnStore::Find(ColumnKind kind, uint32_t index, std::string_view name) const {
+    for (size_t i = 0; i < columns_.size(); ++i) {
+        const Column& column = columns_[i];
+        if (column.kind == kind && column.index == index && column.name == name) {
+            return i;
+        }
+    }
+    return columns_.size();
+}
+
+void ColumnStore::Set(ColumnKind kind, uint32_t index, std::string_view name, float value) {
+    if (timestamps_.empty()) {
+        return;
+    }
+    size_t i = cursor_;
+    if (i >= columns_.size() || columns_[i].kind != kind ||
+        columns_[i].index != index || columns_[i].name != name) {
+        i = Find(kind, index, name);
+        if (i == columns_.size()) {
+            // 新出现的列, 之前的行都没有值
+            columns_.push_back({kind, index, std::string(name),
+                                std::vector<float>(timestamps_.size(), MISSING)});
+        }
+    }
+    columns_[i].values[current_] = value;
+    cursor_ = i + 1;
+}
+
+ColumnStore ColumnStore::Recent(int64_t since) const {
+    // 时间戳按行递增, 从最新的一行往前找到第一条早于since的
+    size_t first = size();
+    while (first > 0 && timestamp(first - 1) >= since) {
+        --first;
+    }
+    ColumnStore copy(std::max<size_t>(size() - first, 1));
+    for (size_t row = first; row < size(); ++row) {
+        copy.timestamps_.push_back(timestamp(row));
+    }
+    for (const auto& column : columns_) {
+        Column slice{column.kind, column.index, column.name, {}};
+        slice.values.reserve(copy.size());
+        bool has_value = false;
+        for (size_t row = first; row < size(); ++row) {
+            float value = column.values[Slot(row)];
+            has_value = has_value || !std::isnan(value);
+            slice.values.push_back(value);
+        }
+        if (has_value) {
+            copy.columns_.push_back(std::move(slice));
+        }
+    }
+    return copy;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// 扩展指标的列类型, 同一类型用index(核号)或name(设备名)区分不同的列
+enum class ColumnKind : uint8_t {
+    CORE_USAGE,
+    LOAD1,
+    LOAD5,
+    LOAD15,
+    DISK_READ,
+    DISK_WRITE,
+    NET_RX,
+    NET_TX,
+    CGROUP_CPU,
+    CGROUP_MEMORY,
+    CGROUP_IO_READ,
+    CGROUP_IO_WRITE,
+    COLLECTOR_CPU,
+    COLLECTOR_RSS,
+    COLLECTOR_LEVEL,
+};
+
+// 一个序列的扩展指标按列存放: 所有列共用一个时间戳环, 每列一个float环, 某一行没有的值是NaN.
+// 和RollupRing一样按需增长到capacity后覆盖最旧的一行.
+// 每行写入的列顺序一般不变, Set先看上一次写的下一列是不是同一个, 稳定之后不做查找也不分配内存.
+// 设备和容器会消失, 每转完一圈去掉整圈都没有值的列, 列数不会随着容器来来去去一直增长.
+class ColumnStore {
+public:
+    explicit ColumnStore(size_t capacity) : capacity_(capacity) {}
+
+    // 开始新的一行, 之后用Set填这一行的各列
+    void BeginRow(int64_t timestamp);
+    void Set(ColumnKind kind, uint32_t index, std::string_view name, float value);
+
+    size_t size() const { return timestamps_.size(); }
+    bool empty() const { return timestamps_.empty(); }
+    // row = 0 是最旧的一行
+    int64_t timestamp(size_t row) const { return timestamps_[Slot(row)]; }
+
+    size_t column_count() const { return columns_.size(); }
+    ColumnKind kind(size_t column) const { return columns_[column].kind; }
+    uint32_t index(size_t column) const { return columns_[column].index; }
+    const std::string& name(size_t column) const { return columns_[column].name; }
+    float value(size_t column, size_t row) const { return columns_[column].values[Slot(row)]; }
+    // 找不到返回column_count()
+    size_t Find(ColumnKind kind, uint32_t index, std::string_view name) const;
+    // 只拷贝时间戳不早于since的那些行, 这些行里全是NaN的列不拷贝. 查询在分片锁内用它代替整个拷贝
+    ColumnStore Recent(int64_t since) const;
+
+private:
+    struct Column {
+        ColumnKind kind;
+        uint32_t index;
+        std::string name;
+        std::vector<float> values;
+    };
+
+    size_t Slot(size_t row) const { return (head_ + row) % timestamps_.size(); }
+    void DropEmptyColumns();
+
+    size_t capacity_;
+    std::vector<int64_t> timestamps_;
+    std::vector<Column> columns_;
+    size_t head_ = 0;
+    size_t current_ = 0; // 正在写的行所在的位置
+    size_t cursor_ = 0;  // 预计下一个Set写的列
+};
@@ -0,0 +1,53 @@
+#include "downsample.h"
+
+#include <algorithm>
+
+namespace {
+
+int64_t AlignDown(int64_t ts, int64_t start_ms, int64_t width_ms) {
+    int64_t offset = ts - start_ms;
+    int64_t index = offset >= 0 ? offset / width_ms : -((-offset + width_ms - 1) / width_ms);
+    return start_ms + index * width_ms;
+}
+
+void Merge(RollupBucket& into, const RollupBucket& from) {
+    into.count += from.count;
+    into.cpu_min = std::min(into.cpu_min, from.cpu_min);
+    into.cpu_max = std::max(into.cpu_max, from.cpu_max);
+    into.cpu_sum += from.cpu_sum;
+    into.mem_min = std::min(into.mem_min, from.mem_min);
+    into.mem_max = std::max(into.mem_max, from.mem_max);
+    into.mem_sum += from.mem_sum;
+}
+
+} // namespace
+
+std::vector<RollupBucket> MergeBuckets(const std::vector<RollupBucket>& buckets,
+                                       int64_t start_ms, int64_t width_ms) {
+    std::vector<RollupBucket> result;
+    if (width_ms <= 0) {
+        return buckets;
+    }
+    for (const auto& bucket : buckets) {
+        int64_t aligned = AlignDown(bucket.start, start_ms, width_ms);
+        if (!result.empty() && result.back().start == aligned) {
+            Merge(result.back(), bucket);
+        } else {
+            result.push_back(bucket);
+            result.back().start = aligned;
+        }
+    }
+    return result;
+}
+
+std::vector<RollupBucket> BucketizeSamples(const std::vector<Sample>& samples,
+                                           int64_t start_ms, int64_t width_ms) {
+    std::vector<RollupBucket> buckets;
+    buckets.reserve(samples.size());
+    for (const auto& s : samples) {
+        buckets.push_back({s.timestamp, 1,
+                           s.cpu_usage, s.cpu_usage, s.cpu_usage,
+                           s.memory_usage, s.memory_usage, s.memory_usage});
+    }
+    return MergeBuckets(buckets, start_ms, width_ms);
+}
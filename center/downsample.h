@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "gorilla.h"
+#include "rollup.h"
+
+// min/max-per-bucket降采样: 把时间从start_ms开始按width_ms切成桶,
+// 落在同一个桶里的输入合并成一个(最小值取最小, 最大值取最大, sum和count相加).
+// 输入必须按时间排好序, 输出也是有序的.
+std::vector<RollupBucket> MergeBuckets(const std::vector<RollupBucket>& buckets,
+                                       int64_t start_ms, int64_t width_ms);
+
+// 原始数据先当成count=1的桶, 再按width_ms合并
+std::vector<RollupBucket> BucketizeSamples(const std::vector<Sample>& samples,
+                                           int64_t start_ms, int64_t width_ms);
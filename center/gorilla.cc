@@ -0,0 +1,214 @@
+#include "gorilla.h"
+
+#include <cstring>
+
+namespace {
+
+uint32_t FloatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float BitsFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// 把nbits位的补码还原成有符号数
+int64_t SignExtend(uint64_t value, int nbits) {
+    uint64_t sign = 1ULL << (nbits - 1);
+    return static_cast<int64_t>((value ^ sign) - sign);
+}
+
+bool FitsIn(int64_t value, int nbits) {
+    int64_t limit = 1LL << (nbits - 1);
+    return value >= -limit && value < limit;
+}
+
+// delta-of-delta的分档: 前缀 '0' / '10' / '110' / '1110' / '1111',
+// 时间戳是毫秒, 采集抖动一般在几毫秒到几百毫秒之间, 所以档位比论文(秒)里的宽一些
+const int DOD_BITS[] = {7, 12, 20};
+
+} // namespace
+
+void BitWriter::WriteBit(bool bit) {
+    if (nbits_ % 8 == 0) {
+        buf_.push_back(0);
+    }
+    if (bit) {
+        buf_.back() |= static_cast<uint8_t>(0x80 >> (nbits_ % 8));
+    }
+    ++nbits_;
+}
+
+void BitWriter::WriteBits(uint64_t value, int nbits) {
+    for (int i = nbits - 1; i >= 0; --i) {
+        WriteBit((value >> i) & 1);
+    }
+}
+
+bool BitReader::ReadBit() {
+    if (pos_ >= nbits_) {
+        return false;
+    }
+    bool bit = (data_[pos_ / 8] >> (7 - pos_ % 8)) & 1;
+    ++pos_;
+    return bit;
+}
+
+uint64_t BitReader::ReadBits(int nbits) {
+    uint64_t value = 0;
+    for (int i = 0; i < nbits; ++i) {
+        value = (value << 1) | (ReadBit() ? 1 : 0);
+    }
+    return value;
+}
+
+GorillaChunk GorillaChunk::FromSealed(std::vector<uint8_t> data, size_t nbits, size_t count,
+                                      int64_t first_ts, int64_t last_ts) {
+    GorillaChunk chunk;
+    chunk.writer_ = BitWriter(std::move(data), nbits);
+    chunk.count_ = count;
+    chunk.first_ts_ = first_ts;
+    chunk.prev_ts_ = last_ts;
+    chunk.sealed_ = true;
+    return chunk;
+}
+
+bool GorillaChunk::Full(int64_t timestamp) const {
+    return sealed_ || count_ >= MAX_SAMPLES || (count_ > 0 && timestamp - first_ts_ >= MAX_SPAN_MS);
+}
+
+bool GorillaChunk::Append(const Sample& sample) {
+    if (sealed_) {
+        return false;
+    }
+    if (count_ == 0) {
+        // 第一条原样写入
+        first_ts_ = sample.timestamp;
+        prev_ts_ = sample.timestamp;
+        writer_.WriteBits(static_cast<uint64_t>(sample.timestamp), 64);
+        cpu_.prev_bits = FloatBits(sample.cpu_usage);
+        mem_.prev_bits = FloatBits(sample.memory_usage);
+        writer_.WriteBits(cpu_.prev_bits, 32);
+        writer_.WriteBits(mem_.prev_bits, 32);
+        count_ = 1;
+        return true;
+    }
+    if (sample.timestamp <= prev_ts_) {
+        return false;
+    }
+    WriteTimestamp(sample.timestamp);
+    WriteValue(cpu_, sample.cpu_usage);
+    WriteValue(mem_, sample.memory_usage);
+    ++count_;
+    return true;
+}
+
+void GorillaChunk::WriteTimestamp(int64_t timestamp) {
+    int64_t delta = timestamp - prev_ts_;
+    int64_t dod = delta - prev_delta_;
+    prev_ts_ = timestamp;
+    prev_delta_ = delta;
+
+    if (dod == 0) {
+        writer_.WriteBit(0);
+        return;
+    }
+    for (int i = 0; i < 3; ++i) {
+        if (FitsIn(dod, DOD_BITS[i])) {
+            // i+1个1再跟一个0
+            writer_.WriteBits((1ULL << (i + 2)) - 2, i + 2);
+            writer_.WriteBits(static_cast<uint64_t>(dod), DOD_BITS[i]);
+            return;
+        }
+    }
+    writer_.WriteBits(0xF, 4);
+    writer_.WriteBits(static_cast<uint64_t>(dod), 64);
+}
+
+void GorillaChunk::WriteValue(ValueState& state, float value) {
+    uint32_t bits = FloatBits(value);
+    uint32_t x = bits ^ state.prev_bits;
+    state.prev_bits = bits;
+
+    if (x == 0) {
+        writer_.WriteBit(0);
+        return;
+    }
+    writer_.WriteBit(1);
+
+    int leading = __builtin_clz(x);
+    int trailing = __builtin_ctz(x);
+    if (state.leading >= 0 && leading >= state.leading && trailing >= state.trailing) {
+        // 有效位落在上一次的窗口里, 直接复用窗口
+        writer_.WriteBit(0);
+        int meaningful = 32 - state.leading - state.trailing;
+        writer_.WriteBits(x >> state.trailing, meaningful);
+        return;
+    }
+
+    // 新窗口: 5位前导零个数 + 5位(有效位长度-1) + 有效位
+    int meaningful = 32 - leading - trailing;
+    writer_.WriteBit(1);
+    writer_.WriteBits(leading, 5);
+    writer_.WriteBits(meaningful - 1, 5);
+    writer_.WriteBits(x >> trailing, meaningful);
+    state.leading = leading;
+    state.trailing = trailing;
+}
+
+GorillaChunk::Iterator::Iterator(const GorillaChunk& chunk)
+    : reader_(chunk.writer_.data().data(), chunk.writer_.bit_size()),
+      remaining_(chunk.count_) {}
+
+bool GorillaChunk::Iterator::Next(Sample* out) {
+    if (remaining_ == 0) {
+        return false;
+    }
+    --remaining_;
+
+    if (index_++ == 0) {
+        prev_ts_ = static_cast<int64_t>(reader_.ReadBits(64));
+        cpu_.prev_bits = static_cast<uint32_t>(reader_.ReadBits(32));
+        mem_.prev_bits = static_cast<uint32_t>(reader_.ReadBits(32));
+        *out = {prev_ts_, BitsFloat(cpu_.prev_bits), BitsFloat(mem_.prev_bits)};
+        return true;
+    }
+
+    // 数出前缀里1的个数, 最多4个
+    int ones = 0;
+    while (ones < 4 && reader_.ReadBit()) {
+        ++ones;
+    }
+    int64_t dod = 0;
+    if (ones == 4) {
+        dod = static_cast<int64_t>(reader_.ReadBits(64));
+    } else if (ones > 0) {
+        int nbits = DOD_BITS[ones - 1];
+        dod = SignExtend(reader_.ReadBits(nbits), nbits);
+    }
+    prev_delta_ += dod;
+    prev_ts_ += prev_delta_;
+
+    out->timestamp = prev_ts_;
+    out->cpu_usage = ReadValue(cpu_);
+    out->memory_usage = ReadValue(mem_);
+    return true;
+}
+
+float GorillaChunk::Iterator::ReadValue(ValueState& state) {
+    if (reader_.ReadBit()) {
+        if (reader_.ReadBit()) {
+            state.leading = static_cast<int>(reader_.ReadBits(5));
+            int meaningful = static_cast<int>(reader_.ReadBits(5)) + 1;
+            state.trailing = 32 - state.leading - meaningful;
+        }
+        int meaningful = 32 - state.leading - state.trailing;
+        uint32_t x = static_cast<uint32_t>(reader_.ReadBits(meaningful)) << state.trailing;
+        state.prev_bits ^= x;
+    }
+    return BitsFloat(state.prev_bits);
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// 单条采样, 只保留数值, 服务器名在每个序列里只存一份
+struct Sample {
+    int64_t timestamp;
+    float cpu_usage;
+    float memory_usage;
+};
+static_assert(sizeof(Sample) == 16, "Sample should stay a packed 16-byte POD");
+
+// 按位追加写入, 高位在前
+class BitWriter {
+public:
+    BitWriter() = default;
+    BitWriter(std::vector<uint8_t> buf, size_t nbits) : buf_(std::move(buf)), nbits_(nbits) {}
+
+    void WriteBit(bool bit);
+    // 写入value的低nbits位
+    void WriteBits(uint64_t value, int nbits);
+
+    const std::vector<uint8_t>& data() const { return buf_; }
+    size_t bit_size() const { return nbits_; }
+
+private:
+    std::vector<uint8_t> buf_;
+    size_t nbits_ = 0;
+};
+
+class BitReader {
+public:
+    BitReader(const uint8_t* data, size_t nbits) : data_(data), nbits_(nbits), pos_(0) {}
+
+    bool ReadBit();
+    uint64_t ReadBits(int nbits);
+    bool Exhausted() const { return pos_ >= nbits_; }
+
+private:
+    const uint8_t* data_;
+    size_t nbits_;
+    size_t pos_;
+};
+
+// Facebook Gorilla论文里的压缩块: 时间戳做delta-of-delta, 浮点数和上一个值做XOR.
+// 每个块只能追加, 写满(条数或时间跨度)后由调用方另开新块.
+// 采集间隔稳定时, 一条{时间戳, CPU, 内存}通常只要几个字节.
+class GorillaChunk {
+public:
+    static constexpr size_t MAX_SAMPLES = 1024;
+    static constexpr int64_t MAX_SPAN_MS = 2 * 3600 * 1000; // 一个块最多覆盖2小时
+
+    // 用快照里的原始字节恢复一个写满的块, 恢复出来的块只读, 不能再追加
+    static GorillaChunk FromSealed(std::vector<uint8_t> data, size_t nbits, size_t count,
+                                   int64_t first_ts, int64_t last_ts);
+
+    // 时间戳必须严格递增, 否则返回false且不写入
+    bool Append(const Sample& sample);
+    // 再追加一条时间戳为timestamp的采样是否需要新开一个块
+    bool Full(int64_t timestamp) const;
+
+    size_t count() const { return count_; }
+    bool empty() const { return count_ == 0; }
+    int64_t first_timestamp() const { return first_ts_; }
+    int64_t last_timestamp() const { return prev_ts_; }
+    size_t bytes() const { return writer_.data().size(); }
+    const std::vector<uint8_t>& data() const { return writer_.data(); }
+    size_t bit_size() const { return writer_.bit_size(); }
+
+    // 顺序解码块里的采样
+    class Iterator {
+    public:
+        explicit Iterator(const GorillaChunk& chunk);
+        // 没有更多数据时返回false
+        bool Next(Sample* out);
+
+    private:
+        struct ValueState {
+            uint32_t prev_bits = 0;
+            int leading = 0;
+            int trailing = 0;
+        };
+        float ReadValue(ValueState& state);
+
+        BitReader reader_;
+        size_t remaining_;
+        size_t index_ = 0;
+        int64_t prev_ts_ = 0;
+        int64_t prev_delta_ = 0;
+        ValueState cpu_;
+        ValueState mem_;
+    };
+
+    Iterator Begin() const { return Iterator(*this); }
+
+private:
+    struct ValueState {
+        uint32_t prev_bits = 0;
+        int leading = -1; // -1表示还没有可复用的有效位窗口
+        int trailing = 0;
+    };
+    void WriteTimestamp(int64_t timestamp);
+    void WriteValue(ValueState& state, float value);
+
+    BitWriter writer_;
+    size_t count_ = 0;
+    int64_t first_ts_ = 0;
+    int64_t prev_ts_ = 0;
+    int64_t prev_delta_ = 0;
+    ValueState cpu_;
+    ValueState mem_;
+    bool sealed_ = false;
+};
@@ -0,0 +1,852 @@
+#include "metrics_storage.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <random>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "async_logging.h"
+#include "wal.h"
+
+namespace {
+
+int64_t NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+}
+
+// data是RepeatedPtrField复用的已清空对象, 名字的字符串缓冲区也会复用
+void FillMetricsData(const std::string& server_name, const Sample& sample, dmonitor::MetricsData* data) {
+    data->set_server_name(server_name);
+    data->set_timestamp(sample.timestamp);
+    data->set_cpu_usage(sample.cpu_usage);
+    data->set_memory_usage(sample.memory_usage);
+}
+
+bool HasProcesses(const dmonitor::MetricsData& metrics) {
+    return metrics.top_cpu_size() > 0 || metrics.top_rss_size() > 0;
+}
+
+bool HasExtended(const dmonitor::MetricsData& metrics) {
+    return metrics.core_usage_size() > 0 || metrics.load1() != 0 || metrics.load5() != 0 ||
+           metrics.load15() != 0 || metrics.disk_names_size() > 0 || metrics.net_names_size() > 0 ||
+           HasProcesses(metrics) || metrics.cgroups_size() > 0 || metrics.collector_rss_bytes() != 0;
+}
+
+void StoreExtended(ColumnStore& columns, const dmonitor::MetricsData& metrics) {
+    columns.BeginRow(metrics.timestamp());
+    for (int i = 0; i < metrics.core_usage_size(); ++i) {
+        columns.Set(ColumnKind::CORE_USAGE, i, {}, metrics.core_usage(i));
+    }
+    columns.Set(ColumnKind::LOAD1, 0, {}, metrics.load1());
+    columns.Set(ColumnKind::LOAD5, 0, {}, metrics.load5());
+    columns.Set(ColumnKind::LOAD15, 0, {}, metrics.load15());
+    // 名字和数值是并列数组, 长度不一致时按短的算
+    int disks = std::min({metrics.disk_names_size(), metrics.disk_read_bps_size(), metrics.disk_write_bps_size()});
+    for (int i = 0; i < disks; ++i) {
+        columns.Set(ColumnKind::DISK_READ, 0, metrics.disk_names(i), metrics.disk_read_bps(i));
+        columns.Set(ColumnKind::DISK_WRITE, 0, metrics.disk_names(i), metrics.disk_write_bps(i));
+    }
+    int nets = std::min({metrics.net_names_size(), metrics.net_rx_bps_size(), metrics.net_tx_bps_size()});
+    for (int i = 0; i < nets; ++i) {
+        columns.Set(ColumnKind::NET_RX, 0, metrics.net_names(i), metrics.net_rx_bps(i));
+        columns.Set(ColumnKind::NET_TX, 0, metrics.net_names(i), metrics.net_tx_bps(i));
+    }
+    if (metrics.collector_rss_bytes() != 0) {
+        columns.Set(ColumnKind::COLLECTOR_CPU, 0, {}, metrics.collector_cpu_usage());
+        columns.Set(ColumnKind::COLLECTOR_RSS, 0, {}, static_cast<float>(metrics.collector_rss_bytes()));
+        columns.Set(ColumnKind::COLLECTOR_LEVEL, 0, {}, static_cast<float>(metrics.collector_throttle_level()));
+    }
+}
+
+// 容器按路径各占四列, 内存用float存, 精度对监控足够
+void StoreContainers(ColumnStore& columns, const dmonitor::MetricsData& metrics) {
+    columns.BeginRow(metrics.timestamp());
+    for (const auto& cgroup : metrics.cgroups()) {
+        columns.Set(ColumnKind::CGROUP_CPU, 0, cgroup.path(), cgroup.cpu_usage());
+        columns.Set(ColumnKind::CGROUP_MEMORY, 0, cgroup.path(), static_cast<float>(cgroup.memory_bytes()));
+        columns.Set(ColumnKind::CGROUP_IO_READ, 0, cgroup.path(), cgroup.io_read_bps());
+        columns.Set(ColumnKind::CGROUP_IO_WRITE, 0, cgroup.path(), cgroup.io_write_bps());
+    }
+}
+
+// 把一行扩展指标还原回MetricsData的字段, 这一行没有值(NaN)的列跳过
+void FillExtended(const ColumnStore& columns, size_t row, dmonitor::MetricsData* metrics) {
+    for (size_t c = 0; c < columns.column_count(); ++c) {
+        float value = columns.value(c, row);
+        if (std::isnan(value)) {
+            continue;
+        }
+        switch (columns.kind(c)) {
+        case ColumnKind::CORE_USAGE: metrics->add_core_usage(value); break;
+        case ColumnKind::LOAD1: metrics->set_load1(value); break;
+        case ColumnKind::LOAD5: metrics->set_load5(value); break;
+        case ColumnKind::LOAD15: metrics->set_load15(value); break;
+        case ColumnKind::DISK_READ: {
+            size_t write = columns.Find(ColumnKind::DISK_WRITE, 0, columns.name(c));
+            metrics->add_disk_names(columns.name(c));
+            metrics->add_disk_read_bps(value);
+            metrics->add_disk_write_bps(write < columns.column_count() ? columns.value(write, row) : 0);
+            break;
+        }
+        case ColumnKind::NET_RX: {
+            size_t tx = columns.Find(ColumnKind::NET_TX, 0, columns.name(c));
+            metrics->add_net_names(columns.name(c));
+            metrics->add_net_rx_bps(value);
+            metrics->add_net_tx_bps(tx < columns.column_count() ? columns.value(tx, row) : 0);
+            break;
+        }
+        case ColumnKind::CGROUP_CPU: {
+            auto other = [&](ColumnKind kind) {
+                size_t c2 = columns.Find(kind, 0, columns.name(c));
+                float v = c2 < columns.column_count() ? columns.value(c2, row) : 0;
+                return std::isnan(v) ? 0.0f : v;
+            };
+            dmonitor::CgroupInfo* cgroup = metrics->add_cgroups();
+            cgroup->set_path(columns.name(c));
+            cgroup->set_cpu_usage(value);
+            cgroup->set_memory_bytes(static_cast<uint64_t>(other(ColumnKind::CGROUP_MEMORY)));
+            cgroup->set_io_read_bps(other(ColumnKind::CGROUP_IO_READ));
+            cgroup->set_io_write_bps(other(ColumnKind::CGROUP_IO_WRITE));
+            break;
+        }
+        case ColumnKind::COLLECTOR_CPU: metrics->set_collector_cpu_usage(value); break;
+        case ColumnKind::COLLECTOR_RSS: metrics->set_collector_rss_bytes(static_cast<uint64_t>(value)); break;
+        case ColumnKind::COLLECTOR_LEVEL: metrics->set_collector_throttle_level(static_cast<uint32_t>(value)); break;
+        default: // 写/发送方向和容器的其余列跟着第一列一起填
+            break;
+        }
+    }
+}
+
+uint64_t RandomIncarnation() {
+    std::random_device rd;
+    return (static_cast<uint64_t>(rd()) << 32) | rd();
+}
+
+// 快照格式: 8字节magic, 之后每个序列一条记录, 直到文件结尾
+//   u32序列ID
+//   u16名字长度 + 名字
+//   u32最近数据条数 + Sample数组
+//   u32压缩块个数 + 每个块{u32条数, u64位数, i64首时间戳, i64尾时间戳, 字节}
+//   每个分辨率{u32桶数 + RollupBucket数组}
+const char SNAPSHOT_MAGIC[8] = {'D', 'M', 'S', 'N', 'A', 'P', '0', '3'};
+
+template <typename T>
+void Put(std::string& buf, const T& value) {
+    buf.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool Get(const char*& ptr, const char* end, T* value) {
+    if (end - ptr < static_cast<ptrdiff_t>(sizeof(T))) {
+        return false;
+    }
+    std::memcpy(value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return true;
+}
+
+} // namespace
+
+void LatestSlot::Store(const Sample& sample, bool online) {
+    uint32_t seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    timestamp_.store(sample.timestamp, std::memory_order_relaxed);
+    cpu_usage_.store(sample.cpu_usage, std::memory_order_relaxed);
+    memory_usage_.store(sample.memory_usage, std::memory_order_relaxed);
+    online_.store(online, std::memory_order_relaxed);
+    seq_.store(seq + 2, std::memory_order_release);
+}
+
+void LatestSlot::SetOnline(bool online) {
+    // 单个字段, 不需要改序号; 读者读到新旧两种状态都是合法的
+    online_.store(online, std::memory_order_relaxed);
+}
+
+bool LatestSlot::Load(Sample* sample, bool* online) const {
+    while (true) {
+        uint32_t seq = seq_.load(std::memory_order_acquire);
+        if (seq & 1) {
+            continue;
+        }
+        sample->timestamp = timestamp_.load(std::memory_order_relaxed);
+        sample->cpu_usage = cpu_usage_.load(std::memory_order_relaxed);
+        sample->memory_usage = memory_usage_.load(std::memory_order_relaxed);
+        *online = online_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq_.load(std::memory_order_relaxed) == seq) {
+            return seq != 0;
+        }
+    }
+}
+
+MetricsStorage::MetricsStorage() : incarnation_(RandomIncarnation()) {
+    SetMaxSeries(65536);
+}
+
+void MetricsStorage::SetHistoryCapacity(size_t capacity) {
+    if (capacity > 0) {
+        history_capacity_ = capacity;
+    }
+}
+
+void MetricsStorage::SetContainerHistoryCapacity(size_t capacity) {
+    if (capacity > 0) {
+        container_capacity_ = capacity;
+    }
+}
+
+void MetricsStorage::SetRetention(int64_t retention_ms) {
+    if (retention_ms > 0) {
+        retention_ms_ = retention_ms;
+    }
+}
+
+void MetricsStorage::SetMaxSeries(size_t max_series) {
+    if (max_series == 0 || max_series >= UINT32_MAX) {
+        return;
+    }
+    // 下标0不用, 多分配一个
+    max_series_ = max_series;
+    table_.reset(new std::atomic<Series*>[max_series_ + 1]);
+    for (size_t i = 0; i <= max_series_; ++i) {
+        table_[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+MetricsStorage::Series* MetricsStorage::FindSeries(uint32_t series_id) const {
+    if (series_id == 0 || series_id > max_series_) {
+        return nullptr;
+    }
+    return table_[series_id].load(std::memory_order_acquire);
+}
+
+uint32_t MetricsStorage::Lookup(const std::string& server_name) const {
+    std::shared_lock<std::shared_mutex> lock(registry_mutex_);
+    auto it = ids_.find(server_name);
+    return it == ids_.end() ? 0 : it->second;
+}
+
+uint32_t MetricsStorage::RegisterLocked(const std::string& server_name, uint32_t series_id) {
+    auto it = ids_.find(server_name);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+    if (series_id == 0) {
+        series_id = next_id_.load(std::memory_order_relaxed);
+    }
+    if (series_id > max_series_ || table_[series_id].load(std::memory_order_relaxed) != nullptr) {
+        return 0;
+    }
+    owned_.push_back(std::make_unique<Series>(series_id, server_name, history_capacity_));
+    Series* series = owned_.back().get();
+    ids_.emplace(std::string_view(series->name), series_id);
+    // release保证别的线程按ID读到指针时, 序列已经构造完整
+    table_[series_id].store(series, std::memory_order_release);
+    if (series_id >= next_id_.load(std::memory_order_relaxed)) {
+        next_id_.store(series_id + 1, std::memory_order_release);
+    }
+    return series_id;
+}
+
+uint32_t MetricsStorage::Register(const std::string& server_name) {
+    uint32_t series_id = Lookup(server_name);
+    if (series_id != 0) {
+        return series_id;
+    }
+    std::unique_lock<std::shared_mutex> lock(registry_mutex_);
+    bool existed = ids_.count(server_name) > 0;
+    series_id = RegisterLocked(server_name, 0);
+    if (series_id == 0) {
+        ALOG_EVERY_MS(ERROR, 1000, "Series table is full (maxseries=%zu), rejecting %s",
+                      max_series_, server_name.c_str());
+    } else if (!existed && wal_ != nullptr) {
+        // 在注册锁里写WAL, 保证注册记录排在这个ID的所有数据记录前面
+        wal_->AppendRegister(series_id, server_name);
+    }
+    return series_id;
+}
+
+void MetricsStorage::AppendChunk(Series& series, const Sample& sample) {
+    if (series.chunks.empty() || series.chunks.back().Full(sample.timestamp)) {
+        series.chunks.emplace_back();
+    }
+    series.chunks.back().Append(sample);
+
+    // 整块都过了保留期才删, 保证块内数据完整
+    while (series.chunks.size() > 1 &&
+           series.chunks.front().last_timestamp() < sample.timestamp - retention_ms_) {
+        series.chunks.pop_front();
+    }
+}
+
+bool MetricsStorage::ApplyLocked(Series& series, const Sample& sample) {
+    // 压缩块要求时间戳严格递增, 乱序或重复的数据直接丢掉
+    if (!series.recent.empty() && sample.timestamp <= series.recent.back().timestamp) {
+        return false;
+    }
+    series.recent.Push(sample);
+    AppendChunk(series, sample);
+    series.rollups.Add(sample);
+    return true;
+}
+
+void MetricsStorage::StoreExtendedLocked(Series& series, const dmonitor::MetricsData& extended) {
+    if (series.columns == nullptr) {
+        series.columns = std::make_unique<ColumnStore>(history_capacity_);
+    }
+    StoreExtended(*series.columns, extended);
+    if (extended.cgroups_size() > 0) {
+        if (series.containers == nullptr) {
+            series.containers = std::make_unique<ColumnStore>(container_capacity_);
+        }
+        StoreContainers(*series.containers, extended);
+    }
+    if (HasProcesses(extended)) {
+        if (series.processes == nullptr) {
+            series.processes = std::make_unique<dmonitor::MetricsData>();
+        }
+        series.processes->set_timestamp(extended.timestamp());
+        *series.processes->mutable_top_cpu() = extended.top_cpu();
+        *series.processes->mutable_top_rss() = extended.top_rss();
+        series.processes->set_processes_truncated(extended.processes_truncated());
+    }
+}
+
+bool MetricsStorage::Apply(uint32_t series_id, const Sample& sample, const dmonitor::MetricsData* extended,
+                          bool write_wal) {
+    Series* series = FindSeries(series_id);
+    if (series == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(GetShard(series_id).mutex);
+    if (!ApplyLocked(*series, sample)) {
+        return false;
+    }
+    if (extended != nullptr) {
+        StoreExtendedLocked(*series, *extended);
+    }
+    series->latest.Store(sample, NowMs() - sample.timestamp <= OFFLINE_THRESHOLD_MS);
+    MarkDirty();
+    // 先写内存再写WAL: 快照切段之前写进WAL的数据一定已经在内存里, 会被快照带上.
+    // WAL在分片锁里写, 同一序列的WAL顺序和内存里的应用顺序一致, 重放结果不会变
+    if (write_wal && wal_ != nullptr) {
+        wal_->Append(series_id, sample);
+    }
+    return true;
+}
+
+size_t MetricsStorage::AddBatch(uint32_t series_id, std::vector<Sample>* samples,
+                                const dmonitor::MetricsData* extended) {
+    Series* series = FindSeries(series_id);
+    if (series == nullptr || samples->empty()) {
+        return 0;
+    }
+    size_t accepted = 0;
+    {
+        // 整批只加一次分片锁, 被丢弃的数据从samples里挤掉, 剩下的再一起写WAL
+        std::lock_guard<std::mutex> lock(GetShard(series_id).mutex);
+        for (const Sample& sample : *samples) {
+            if (ApplyLocked(*series, sample)) {
+                (*samples)[accepted++] = sample;
+            }
+        }
+        if (accepted == 0) {
+            samples->clear();
+            return 0;
+        }
+        const Sample& last = (*samples)[accepted - 1];
+        if (extended != nullptr && extended->timestamp() == last.timestamp) {
+            StoreExtendedLocked(*series, *extended);
+        }
+        series->latest.Store(last, NowMs() - last.timestamp <= OFFLINE_THRESHOLD_MS);
+        samples->resize(accepted);
+        MarkDirty();
+        // 和单条写入一样在分片锁里写WAL, 保证同一序列的WAL顺序等于应用顺序
+        if (wal_ != nullptr) {
+            wal_->AppendBatch(series_id, *samples);
+        }
+    }
+    ALOG(DEBUG, "Stored %zu metrics from %s", accepted, series->name.c_str());
+    return accepted;
+}
+
+bool MetricsStorage::Touch(uint32_t series_id, int64_t timestamp, const dmonitor::MetricsData* extended) {
+    Series* series = FindSeries(series_id);
+    if (series == nullptr) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(GetShard(series_id).mutex);
+    Sample sample;
+    bool online;
+    if (!series->latest.Load(&sample, &online) || timestamp <= sample.timestamp) {
+        return false;
+    }
+    if (extended != nullptr && extended->timestamp() == timestamp) {
+        StoreExtendedLocked(*series, *extended);
+    }
+    sample.timestamp = timestamp;
+    series->latest.Store(sample, NowMs() - timestamp <= OFFLINE_THRESHOLD_MS);
+    MarkDirty();
+    return true;
+}
+
+bool MetricsStorage::AddMetrics(const dmonitor::MetricsData& metrics) {
+    uint32_t series_id = Register(metrics.server_name());
+    return series_id != 0 && AddMetrics(series_id, metrics);
+}
+
+bool MetricsStorage::AddMetrics(uint32_t series_id, const dmonitor::MetricsData& metrics) {
+    Sample sample{metrics.timestamp(), metrics.cpu_usage(), metrics.memory_usage()};
+    if (!Apply(series_id, sample, HasExtended(metrics) ? &metrics : nullptr, true)) {
+        return false;
+    }
+
+    // 打日志放在锁外面, 不占用分片锁; 每条数据一行, 只在debug级别打
+    ALOG(DEBUG, "[%ld] Stored metrics from %s: CPU=%.2f%%, Memory=%.2f%%",
+         static_cast<long>(metrics.timestamp()), FindSeries(series_id)->name.c_str(),
+         metrics.cpu_usage(), metrics.memory_usage());
+    return true;
+}
+
+bool MetricsStorage::RestoreRegistration(uint32_t series_id, const std::string& server_name) {
+    std::unique_lock<std::shared_mutex> lock(registry_mutex_);
+    if (RegisterLocked(server_name, series_id) != series_id) {
+        ALOG(ERROR, "Restore: series %s conflicts with id %u", server_name.c_str(), series_id);
+        return false;
+    }
+    return true;
+}
+
+bool MetricsStorage::Restore(uint32_t series_id, const Sample& sample) {
+    return Apply(series_id, sample);
+}
+
+void MetricsStorage::QueryMetrics(const std::string& server_name,
+                                  google::protobuf::RepeatedPtrField<dmonitor::MetricsData>* result) {
+    result->Clear();
+
+    if (server_name.empty()) {
+        // 查询所有服务器的最新数据: 只读seqlock发布的最新值, 不拿任何锁, 不会阻塞写入.
+        // 序列对象注册后不会释放, 读名字也是安全的.
+        std::vector<std::pair<const Series*, Sample>> latest;
+        uint32_t id_end = next_id_.load(std::memory_order_acquire);
+        latest.reserve(id_end);
+        for (uint32_t id = 1; id < id_end; ++id) {
+            const Series* series = FindSeries(id);
+            Sample sample;
+            bool online;
+            if (series == nullptr || !series->latest.Load(&sample, &online)) {
+                continue;
+            }
+            if (!online) {
+                // 标记为离线（CPU和内存使用率设为-1）
+                sample.cpu_usage = -1.0;
+                sample.memory_usage = -1.0;
+            }
+            latest.emplace_back(series, sample);
+        }
+
+        // 排序保证TUI里的服务器顺序稳定
+        std::sort(latest.begin(), latest.end(),
+                  [](const auto& a, const auto& b) { return a.first->name < b.first->name; });
+        result->Reserve(static_cast<int>(latest.size()));
+        for (const auto& pair : latest) {
+            FillMetricsData(pair.first->name, pair.second, result->Add());
+        }
+    } else {
+        // 查询指定服务器的所有历史记录, 锁内只拷贝POD和要返回的那些行的列数据, 锁外再构造protobuf消息
+        std::vector<Sample> history;
+        ColumnStore columns(1);
+        ColumnStore containers(1);
+        dmonitor::MetricsData processes;
+        uint32_t series_id = Lookup(server_name);
+        if (const Series* series = FindSeries(series_id)) {
+            std::lock_guard<std::mutex> lock(GetShard(series_id).mutex);
+            const SampleRing& ring = series->recent;
+            history.reserve(ring.size() + 1);
+            for (size_t i = 0; i < ring.size(); ++i) {
+                history.push_back(ring.at(i));
+            }
+            // 心跳之后最新值比历史里最后一条新, 值相同, 补一条让曲线延续到现在
+            Sample latest;
+            bool online;
+            if (!history.empty() && series->latest.Load(&latest, &online) &&
+                latest.timestamp > history.back().timestamp) {
+                history.push_back(latest);
+            }
+            // 列数据比历史留得久, 比最旧一条历史还早的行不会被返回, 不用拷贝
+            int64_t since = history.empty() ? INT64_MAX : history.front().timestamp;
+            if (series->columns != nullptr) {
+                columns = series->columns->Recent(since);
+            }
+            if (series->containers != nullptr) {
+                containers = series->containers->Recent(since);
+            }
+            if (series->processes != nullptr) {
+                processes = *series->processes;
+            }
+        }
+        result->Reserve(static_cast<int>(history.size()));
+        // 都按时间递增, 双指针把扩展指标对到同一时间戳的数据上
+        auto fill = [](const ColumnStore& store, size_t& row, int64_t timestamp, dmonitor::MetricsData* data) {
+            while (row < store.size() && store.timestamp(row) < timestamp) {
+                ++row;
+            }
+            if (row < store.size() && store.timestamp(row) == timestamp) {
+                FillExtended(store, row, data);
+            }
+        };
+        size_t row = 0;
+        size_t container_row = 0;
+        for (const auto& sample : history) {
+            dmonitor::MetricsData* data = result->Add();
+            FillMetricsData(server_name, sample, data);
+            fill(columns, row, sample.timestamp, data);
+            fill(containers, container_row, sample.timestamp, data);
+        }
+        // 进程列表挂回它上报时的那条数据上
+        for (auto it = result->rbegin(); HasProcesses(processes) && it != result->rend(); ++it) {
+            if (it->timestamp() == processes.timestamp()) {
+                it->mutable_top_cpu()->Swap(processes.mutable_top_cpu());
+                it->mutable_top_rss()->Swap(processes.mutable_top_rss());
+                it->set_processes_truncated(processes.processes_truncated());
+                break;
+            }
+        }
+    }
+}
+
+void MetricsStorage::SweepOffline() {
+    int64_t now = NowMs();
+    uint32_t id_end = next_id_.load(std::memory_order_acquire);
+    for (uint32_t id = 1; id < id_end; ++id) {
+        Series* series = FindSeries(id);
+        Sample sample;
+        bool online;
+        if (series == nullptr || !series->latest.Load(&sample, &online)) {
+            continue;
+        }
+        bool expect = now - sample.timestamp <= OFFLINE_THRESHOLD_MS;
+        if (online != expect) {
+            // 加锁后再判断一次, 避免把刚写进来的新数据标成离线
+            std::lock_guard<std::mutex> lock(GetShard(id).mutex);
+            if (series->latest.Load(&sample, &online)) {
+                series->latest.SetOnline(now - sample.timestamp <= OFFLINE_THRESHOLD_MS);
+                MarkDirty();
+            }
+        }
+    }
+}
+
+uint64_t MetricsStorage::ChangeEpoch() {
+    int64_t now = NowMs();
+    std::lock_guard<std::mutex> lock(epoch_mutex_);
+    // 先看时间再清标记, 没到间隔时标记留着, 下次再推进
+    if (now - epoch_time_ms_ >= EPOCH_INTERVAL_MS && dirty_.exchange(false, std::memory_order_acq_rel)) {
+        ++epoch_;
+        epoch_time_ms_ = now;
+    }
+    return epoch_;
+}
+
+std::vector<Sample> MetricsStorage::QueryRange(const std::string& server_name,
+                                               int64_t start_ms, int64_t end_ms) {
+    uint32_t series_id = Lookup(server_name);
+    const Series* series = FindSeries(series_id);
+    if (series == nullptr) {
+        return {};
+    }
+    // 锁内只拷贝和时间范围有交集的压缩块, 解码放到锁外
+    std::vector<GorillaChunk> chunks;
+    Sample latest;
+    bool has_latest;
+    {
+        std::lock_guard<std::mutex> lock(GetShard(series_id).mutex);
+        for (const auto& chunk : series->chunks) {
+            if (chunk.last_timestamp() >= start_ms && chunk.first_timestamp() <= end_ms) {
+                chunks.push_back(chunk);
+            }
+        }
+        bool online;
+        has_latest = series->latest.Load(&latest, &online);
+    }
+
+    std::vector<Sample> result;
+    for (const auto& chunk : chunks) {
+        GorillaChunk::Iterator iter = chunk.Begin();
+        Sample sample;
+        while (iter.Next(&sample)) {
+            if (sample.timestamp > end_ms) {
+                break;
+            }
+            if (sample.timestamp >= start_ms) {
+                result.push_back(sample);
+            }
+        }
+    }
+    // 和QueryMetrics一样, 心跳推进过的最新值补在末尾
+    if (has_latest && !result.empty() && latest.timestamp > result.back().timestamp && latest.timestamp <= end_ms) {
+        result.push_back(latest);
+    }
+    return result;
+}
+
+bool MetricsStorage::QueryRollup(const std::string& server_name, int64_t start_ms, int64_t end_ms,
+                                 int64_t step_ms, std::vector<RollupBucket>* buckets, int64_t* width_ms) {
+    uint32_t series_id = Lookup(server_name);
+    const Series* series = FindSeries(series_id);
+    if (series == nullptr) {
+        *width_ms = step_ms;
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(GetShard(series_id).mutex);
+    const RollupRing* ring = series->rollups.Pick(step_ms, start_ms);
+    if (ring == nullptr) {
+        return false;
+    }
+    *width_ms = ring->width();
+    ring->Query(start_ms, end_ms, buckets);
+    return true;
+}
+
+void MetricsStorage::PrintStatus() {
+    std::vector<std::pair<std::string, int64_t>> last_seen;
+    size_t total_samples = 0;
+    size_t total_bytes = 0;
+    uint32_t id_end = next_id_.load(std::memory_order_acquire);
+    for (uint32_t shard = 0; shard < SHARD_COUNT; ++shard) {
+        std::lock_guard<std::mutex> lock(shards_[shard].mutex);
+        for (uint32_t id = shard == 0 ? SHARD_COUNT : shard; id < id_end; id += SHARD_COUNT) {
+            const Series* series = FindSeries(id);
+            if (series == nullptr) {
+                continue;
+            }
+            if (!series->recent.empty()) {
+                last_seen.emplace_back(series->name, series->recent.back().timestamp);
+            }
+            for (const auto& chunk : series->chunks) {
+                total_samples += chunk.count();
+                total_bytes += chunk.bytes();
+            }
+        }
+    }
+    std::sort(last_seen.begin(), last_seen.end());
+
+    int64_t now = NowMs();
+    std::string status_text = "\n=== Server Status ===\n";
+    for (const auto& pair : last_seen) {
+        int64_t elapsed = now - pair.second;
+        std::string status = (elapsed > OFFLINE_THRESHOLD_MS) ? "OFFLINE" : "ONLINE";
+        status_text += pair.first + ": " + status + " (last seen " + std::to_string(elapsed / 1000) + "s ago)\n";
+    }
+    if (total_samples > 0) {
+        char line[128];
+        snprintf(line, sizeof(line), "History: %zu samples, %zu bytes (%g bytes/sample)\n",
+                 total_samples, total_bytes, static_cast<double>(total_bytes) / total_samples);
+        status_text += line;
+    }
+    status_text += "=====================\n";
+    // 主机多时远超单条格式化日志的长度, 按长度整段交给日志
+    AsyncLogger& logger = AsyncLogger::Instance();
+    if (logger.Enabled(LogSeverity::INFO)) {
+        logger.Log(LogSeverity::INFO, __FILE__, __LINE__, status_text.data(), status_text.size());
+    }
+}
+
+bool MetricsStorage::SaveSnapshot(const std::string& path) {
+    std::string tmp_path = path + ".tmp";
+    FILE* file = fopen(tmp_path.c_str(), "wb");
+    if (file == nullptr) {
+        ALOG(ERROR, "Snapshot: open %s failed: %s", tmp_path.c_str(), strerror(errno));
+        return false;
+    }
+    bool ok = fwrite(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC), 1, file) == 1;
+
+    // 每次只锁一个分片, 锁内只做内存拷贝, 写文件放在锁外.
+    // 还没有数据的序列也要写, 重启后ID才不会变.
+    std::string buf;
+    uint32_t id_end = next_id_.load(std::memory_order_acquire);
+    for (uint32_t shard = 0; shard < SHARD_COUNT; ++shard) {
+        buf.clear();
+        {
+            std::lock_guard<std::mutex> lock(shards_[shard].mutex);
+            for (uint32_t id = shard == 0 ? SHARD_COUNT : shard; id < id_end; id += SHARD_COUNT) {
+                const Series* series = FindSeries(id);
+                if (series == nullptr) {
+                    continue;
+                }
+                Put(buf, series->id);
+                Put(buf, static_cast<uint16_t>(series->name.size()));
+                buf.append(series->name);
+                Put(buf, static_cast<uint32_t>(series->recent.size()));
+                for (size_t i = 0; i < series->recent.size(); ++i) {
+                    Put(buf, series->recent.at(i));
+                }
+                Put(buf, static_cast<uint32_t>(series->chunks.size()));
+                for (const auto& chunk : series->chunks) {
+                    Put(buf, static_cast<uint32_t>(chunk.count()));
+                    Put(buf, static_cast<uint64_t>(chunk.bit_size()));
+                    Put(buf, chunk.first_timestamp());
+                    Put(buf, chunk.last_timestamp());
+                    buf.append(reinterpret_cast<const char*>(chunk.data().data()), chunk.bytes());
+                }
+                for (size_t level = 0; level < Rollups::LEVEL_COUNT; ++level) {
+                    const RollupRing& ring = series->rollups.level(level);
+                    Put(buf, static_cast<uint32_t>(ring.size()));
+                    for (size_t i = 0; i < ring.size(); ++i) {
+                        Put(buf, ring.at(i));
+                    }
+                }
+            }
+        }
+        if (ok && !buf.empty()) {
+            ok = fwrite(buf.data(), buf.size(), 1, file) == 1;
+        }
+    }
+
+    ok = ok && fflush(file) == 0 && fsync(fileno(file)) == 0;
+    fclose(file);
+    if (!ok || rename(tmp_path.c_str(), path.c_str()) != 0) {
+        ALOG(ERROR, "Snapshot: write %s failed", path.c_str());
+        unlink(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool MetricsStorage::LoadSeries(const char*& ptr, const char* end, Series& series) {
+    uint32_t recent_count, chunk_count;
+    if (!Get(ptr, end, &recent_count)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < recent_count; ++i) {
+        Sample sample;
+        if (!Get(ptr, end, &sample)) {
+            return false;
+        }
+        series.recent.Push(sample);
+    }
+    if (!Get(ptr, end, &chunk_count)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < chunk_count; ++i) {
+        uint32_t count;
+        uint64_t nbits;
+        int64_t first_ts, last_ts;
+        if (!Get(ptr, end, &count) || !Get(ptr, end, &nbits) ||
+            !Get(ptr, end, &first_ts) || !Get(ptr, end, &last_ts)) {
+            return false;
+        }
+        size_t nbytes = (nbits + 7) / 8;
+        if (static_cast<size_t>(end - ptr) < nbytes) {
+            return false;
+        }
+        std::vector<uint8_t> data(ptr, ptr + nbytes);
+        ptr += nbytes;
+        GorillaChunk chunk = GorillaChunk::FromSealed(std::move(data), nbits, count, first_ts, last_ts);
+        if (i + 1 < chunk_count) {
+            series.chunks.push_back(std::move(chunk));
+        } else {
+            // 最后一个块还要继续追加, 解码后重新编码一遍, 恢复出编码器状态
+            GorillaChunk open_chunk;
+            GorillaChunk::Iterator iter = chunk.Begin();
+            Sample sample;
+            while (iter.Next(&sample)) {
+                open_chunk.Append(sample);
+            }
+            series.chunks.push_back(std::move(open_chunk));
+        }
+    }
+
+    for (size_t level = 0; level < Rollups::LEVEL_COUNT; ++level) {
+        uint32_t bucket_count;
+        if (!Get(ptr, end, &bucket_count)) {
+            return false;
+        }
+        for (uint32_t i = 0; i < bucket_count; ++i) {
+            RollupBucket bucket;
+            if (!Get(ptr, end, &bucket)) {
+                return false;
+            }
+            series.rollups.level(level).PushBucket(bucket);
+        }
+    }
+    return true;
+}
+
+long MetricsStorage::LoadSnapshot(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(SNAPSHOT_MAGIC))) {
+        close(fd);
+        return -1;
+    }
+    void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return -1;
+    }
+    madvise(addr, st.st_size, MADV_SEQUENTIAL);
+
+    const char* ptr = static_cast<const char*>(addr);
+    const char* end = ptr + st.st_size;
+    if (std::memcmp(ptr, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) {
+        munmap(addr, st.st_size);
+        return -1;
+    }
+    ptr += sizeof(SNAPSHOT_MAGIC);
+
+    long loaded = 0;
+    std::string server_name;
+    while (ptr < end) {
+        uint32_t series_id;
+        uint16_t name_len;
+        if (!Get(ptr, end, &series_id) || !Get(ptr, end, &name_len) || end - ptr < name_len) {
+            break;
+        }
+        server_name.assign(ptr, name_len);
+        ptr += name_len;
+
+        Series loaded_series(series_id, server_name, history_capacity_);
+        if (!LoadSeries(ptr, end, loaded_series)) {
+            ALOG(ERROR, "Snapshot: %s is truncated at series %s", path.c_str(), server_name.c_str());
+            break;
+        }
+
+        {
+            std::unique_lock<std::shared_mutex> lock(registry_mutex_);
+            series_id = RegisterLocked(server_name, series_id);
+        }
+        Series* series = FindSeries(series_id);
+        if (series == nullptr) {
+            ALOG(ERROR, "Snapshot: series %s cannot be registered", server_name.c_str());
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(GetShard(series_id).mutex);
+        series->recent = std::move(loaded_series.recent);
+        series->chunks = std::move(loaded_series.chunks);
+        series->rollups = std::move(loaded_series.rollups);
+        if (!series->recent.empty()) {
+            const Sample& last = series->recent.back();
+            series->latest.Store(last, NowMs() - last.timestamp <= OFFLINE_THRESHOLD_MS);
+            MarkDirty();
+        }
+        ++loaded;
+    }
+
+    munmap(addr, st.st_size);
+    return loaded;
+}
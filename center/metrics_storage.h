@@ -0,0 +1,198 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "columns.h"
+#include "gorilla.h"
+#include "rollup.h"
+#include "monitor.pb.h"
+
+class WriteAheadLog;
+
+// 定长环形缓冲区, 容量在构造时确定, 写满后覆盖最旧的数据, 不再有逐条的堆分配
+class SampleRing {
+public:
+    explicit SampleRing(size_t capacity) : buf_(capacity), head_(0), size_(0) {}
+
+    void Push(const Sample& sample) {
+        buf_[(head_ + size_) % buf_.size()] = sample;
+        if (size_ < buf_.size()) {
+            ++size_;
+        } else {
+            head_ = (head_ + 1) % buf_.size();
+        }
+    }
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+    // i = 0 是最旧的一条
+    const Sample& at(size_t i) const { return buf_[(head_ + i) % buf_.size()]; }
+    const Sample& back() const { return at(size_ - 1); }
+
+private:
+    std::vector<Sample> buf_;
+    size_t head_;
+    size_t size_;
+};
+
+// 一个序列的最新值, 用seqlock发布: 写者(持有分片锁, 同一时刻只有一个)先把序号改成奇数,
+// 写完字段再改回偶数; 读者读到奇数或前后序号不一致就重读. 读者不加锁, 不会阻塞写入.
+class alignas(64) LatestSlot {
+public:
+    void Store(const Sample& sample, bool online);
+    // 只改在线状态, 调用方同样要持有分片锁
+    void SetOnline(bool online);
+    // 还没有数据时返回false
+    bool Load(Sample* sample, bool* online) const;
+
+private:
+    std::atomic<uint32_t> seq_{0};
+    std::atomic<int64_t> timestamp_{0};
+    std::atomic<float> cpu_usage_{0};
+    std::atomic<float> memory_usage_{0};
+    std::atomic<bool> online_{false};
+};
+
+// 数据存储管理类
+// 每个服务器一个序列, 注册时分配一个从1开始的稠密ID, 序列放在按ID下标访问的定长表里,
+// 按ID上报的数据不用再做字符串哈希和比较. 服务器名只在序列里存一份, 名字->ID的索引用string_view指向它.
+// 写入按ID分到SHARD_COUNT个分片锁上, 不同collector的Report可以在muduo的多个IO线程里并行写入.
+// 每个序列: 最近的数据放在环形缓冲区里, 长期历史放在Gorilla压缩块里, 另有多分辨率的汇总桶.
+// 每核使用率, loadavg, 磁盘和网卡速率这些扩展指标按列存在ColumnStore里, 只保留最近的数据.
+// 查询所有服务器时只读每个序列用seqlock发布的最新值, 在线状态由SweepOffline预先算好.
+class MetricsStorage {
+public:
+    MetricsStorage();
+
+    // 下面几个配置只能在启动阶段(还没有数据写入时)调用
+    void SetHistoryCapacity(size_t capacity);
+    void SetContainerHistoryCapacity(size_t capacity);
+    void SetRetention(int64_t retention_ms);
+    void SetMaxSeries(size_t max_series);
+    // 设置之后每条新数据在写入内存后都会追加到WAL
+    void SetWal(WriteAheadLog* wal) { wal_ = wal; }
+
+    // 注册服务器名, 同名重复注册返回同一个ID, 序列表满了返回0
+    uint32_t Register(const std::string& server_name);
+    // 每次启动随机生成, collector上报时带上, 不一致说明center重启过, 要重新注册
+    uint64_t incarnation() const { return incarnation_; }
+    bool HasSeries(uint32_t series_id) const { return FindSeries(series_id) != nullptr; }
+
+    // 按名字上报(兼容没有注册的老collector), 时间戳不比上一条新的数据会被丢弃并返回false
+    bool AddMetrics(const dmonitor::MetricsData& metrics);
+    // 按注册拿到的ID上报, metrics里的server_name可以不填
+    bool AddMetrics(uint32_t series_id, const dmonitor::MetricsData& metrics);
+    // 一批按时间排好序的数据, 只加一次锁, 只写一次WAL. samples里只留下实际写入的数据, 返回条数.
+    // extended的时间戳和最后一条写入的数据相同时, 同时写入它的扩展指标
+    size_t AddBatch(uint32_t series_id, std::vector<Sample>* samples, const dmonitor::MetricsData* extended);
+    // 心跳: collector到timestamp为止采到的值都没有变化. 只把最新值的时间推到timestamp,
+    // 不写历史也不写WAL; 在线判定和查询都把这段空白当作数值不变.
+    // extended的时间戳等于timestamp时同时写入它的扩展指标, 查询时对到补出来的最后一行上
+    bool Touch(uint32_t series_id, int64_t timestamp, const dmonitor::MetricsData* extended = nullptr);
+    // 查询监控数据（空字符串表示查询所有服务器, 这条路径不加任何锁）
+    // 查询单个服务器时, 有扩展指标的那些行会带上扩展指标; 心跳推进过最新值时, 末尾补一条延续到心跳时间的数据.
+    // 结果直接填进result(一般就是响应里的metrics), 先清空; 清空后留着的对象会被复用
+    void QueryMetrics(const std::string& server_name, google::protobuf::RepeatedPtrField<dmonitor::MetricsData>* result);
+    // 把超过OFFLINE_THRESHOLD_MS没有上报的序列标成离线, 由后台线程每秒调用
+    void SweepOffline();
+    // 数据变化的纪元: 写入只置脏标记, 调用这里时最多每EPOCH_INTERVAL_MS推进一次.
+    // 纪元不变说明"所有服务器"的查询结果可以继续用缓存
+    uint64_t ChangeEpoch();
+    // 从压缩块里解码[start_ms, end_ms]之间的历史数据
+    std::vector<Sample> QueryRange(const std::string& server_name, int64_t start_ms, int64_t end_ms);
+    // 从预聚合的桶里查[start_ms, end_ms], 选桶宽不超过step_ms的最粗分辨率, 实际桶宽写到width_ms.
+    // step_ms比最细的分辨率还小时返回false, 这时应该用QueryRange查原始数据.
+    bool QueryRollup(const std::string& server_name, int64_t start_ms, int64_t end_ms, int64_t step_ms,
+                     std::vector<RollupBucket>* buckets, int64_t* width_ms);
+    // 打印所有服务器的在线状态和压缩存储的占用
+    void PrintStatus();
+
+    // 重放WAL时使用: 只写内存, 不打日志也不再写WAL
+    bool RestoreRegistration(uint32_t series_id, const std::string& server_name);
+    bool Restore(uint32_t series_id, const Sample& sample);
+    // 把每个序列的最近数据和压缩块写成快照, 先写临时文件再rename
+    bool SaveSnapshot(const std::string& path);
+    // mmap读入快照, 返回恢复的序列数, 文件不合法返回-1
+    long LoadSnapshot(const std::string& path);
+
+private:
+    static constexpr size_t SHARD_COUNT = 64; // 必须是2的幂
+    const int64_t OFFLINE_THRESHOLD_MS = 10000; // 10秒未上报视为离线
+    const int64_t EPOCH_INTERVAL_MS = 200; // 缓存的概览最多落后这么久
+    // 每个服务器环形缓冲区保留的条数, 可以通过配置文件的historycapacity修改
+    size_t history_capacity_ = 1200; // 3秒一条, 默认1小时
+    // 容器指标每个容器四列, 容器多时占内存最多, 单独只留最近的, 可以通过配置文件的containerhistory修改
+    size_t container_capacity_ = 100; // 3秒一条, 默认5分钟
+    // 压缩历史保留多久, 可以通过配置文件的retentionhours修改
+    int64_t retention_ms_ = 24 * 3600 * 1000LL;
+    WriteAheadLog* wal_ = nullptr;
+
+    struct Series {
+        Series(uint32_t series_id, const std::string& server_name, size_t capacity)
+            : id(series_id), name(server_name), recent(capacity) {}
+        const uint32_t id;
+        const std::string name;
+        SampleRing recent;
+        LatestSlot latest; // 独占一条cache line, 读者轮询不会和写入的其他字段伪共享
+        std::deque<GorillaChunk> chunks; // 按时间排列, 只有最后一个块还在追加
+        Rollups rollups;
+        std::unique_ptr<ColumnStore> columns; // 第一次收到扩展指标时才创建
+        std::unique_ptr<ColumnStore> containers; // 容器指标, 第一次收到时才创建
+        // 最近一次上报的占用最高的进程(只有timestamp和top_*字段), 进程列表不进历史
+        std::unique_ptr<dmonitor::MetricsData> processes;
+    };
+
+    // 每个分片独占一条cache line, 避免相邻分片的锁互相伪共享
+    struct alignas(64) Shard {
+        std::mutex mutex;
+    };
+    std::array<Shard, SHARD_COUNT> shards_;
+
+    // 序列表: 下标就是ID(0不用), 启动时按maxseries分配好, 之后不再扩容, 按ID读不需要加锁
+    size_t max_series_ = 0;
+    std::unique_ptr<std::atomic<Series*>[]> table_;
+    std::atomic<uint32_t> next_id_{1};
+    // 名字->ID的索引和序列对象的所有权, 只有注册时写
+    mutable std::shared_mutex registry_mutex_;
+    std::unordered_map<std::string_view, uint32_t> ids_;
+    std::vector<std::unique_ptr<Series>> owned_;
+    const uint64_t incarnation_;
+
+    // 所有写入方都会碰这个标记, 单独占一条cache line
+    alignas(64) std::atomic<bool> dirty_{true};
+    std::mutex epoch_mutex_;
+    uint64_t epoch_ = 0;
+    int64_t epoch_time_ms_ = 0;
+
+    void MarkDirty() {
+        // 先读再写, 标记已经置上时不去抢cache line的独占权
+        if (!dirty_.load(std::memory_order_relaxed)) {
+            dirty_.store(true, std::memory_order_release);
+        }
+    }
+
+    Shard& GetShard(uint32_t series_id) { return shards_[series_id & (SHARD_COUNT - 1)]; }
+    Series* FindSeries(uint32_t series_id) const;
+    uint32_t Lookup(const std::string& server_name) const;
+    // 注册并返回ID, 指定了series_id时按它注册(恢复时使用)
+    uint32_t RegisterLocked(const std::string& server_name, uint32_t series_id);
+    // 调用方持有分片锁, 只写最近数据/压缩块/汇总桶, 乱序或重复的数据返回false
+    bool ApplyLocked(Series& series, const Sample& sample);
+    void StoreExtendedLocked(Series& series, const dmonitor::MetricsData& extended);
+    // 写入内存, 乱序或重复的数据返回false. extended不为空时同时写入它的扩展指标,
+    // write_wal为true时在分片锁里追加WAL(恢复路径不写)
+    bool Apply(uint32_t series_id, const Sample& sample, const dmonitor::MetricsData* extended = nullptr,
+               bool write_wal = false);
+    void AppendChunk(Series& series, const Sample& sample);
+    // 读快照里的一个序列(注册信息之后的部分)
+    bool LoadSeries(const char*& ptr, const char* end, Series& series);
+};
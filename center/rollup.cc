@@ -0,0 +1,99 @@
+#include "rollup.h"
+
+#include <algorithm>
+
+namespace {
+
+// 桶宽和最多保留的桶数, 越粗的分辨率保留越久
+struct RollupLevel {
+    int64_t width_ms;
+    size_t capacity;
+};
+const RollupLevel ROLLUP_LEVELS[Rollups::LEVEL_COUNT] = {
+    {10 * 1000LL, 360},   // 10秒, 1小时
+    {60 * 1000LL, 360},   // 1分钟, 6小时
+    {300 * 1000LL, 576},  // 5分钟, 2天
+    {3600 * 1000LL, 720}, // 1小时, 30天
+};
+
+} // namespace
+
+void RollupRing::Add(const Sample& sample) {
+    int64_t start = sample.timestamp - sample.timestamp % width_ms_;
+    if (!buf_.empty() && back().start == start) {
+        RollupBucket& bucket = mutable_back();
+        ++bucket.count;
+        bucket.cpu_min = std::min(bucket.cpu_min, sample.cpu_usage);
+        bucket.cpu_max = std::max(bucket.cpu_max, sample.cpu_usage);
+        bucket.cpu_sum += sample.cpu_usage;
+        bucket.mem_min = std::min(bucket.mem_min, sample.memory_usage);
+        bucket.mem_max = std::max(bucket.mem_max, sample.memory_usage);
+        bucket.mem_sum += sample.memory_usage;
+        return;
+    }
+    PushBucket({start, 1,
+                sample.cpu_usage, sample.cpu_usage, sample.cpu_usage,
+                sample.memory_usage, sample.memory_usage, sample.memory_usage});
+}
+
+void RollupRing::PushBucket(const RollupBucket& bucket) {
+    if (buf_.size() < capacity_) {
+        buf_.push_back(bucket);
+    } else {
+        buf_[head_] = bucket;
+        head_ = (head_ + 1) % buf_.size();
+    }
+}
+
+void RollupRing::Query(int64_t start_ms, int64_t end_ms, std::vector<RollupBucket>* out) const {
+    // 桶按start递增, 二分找第一个结束时间不早于start_ms的桶
+    size_t lo = 0, hi = buf_.size();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (at(mid).start + width_ms_ <= start_ms) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    for (size_t i = lo; i < buf_.size() && at(i).start <= end_ms; ++i) {
+        out->push_back(at(i));
+    }
+}
+
+Rollups::Rollups() {
+    levels_.reserve(LEVEL_COUNT);
+    for (const auto& level : ROLLUP_LEVELS) {
+        levels_.emplace_back(level.width_ms, level.capacity);
+    }
+}
+
+void Rollups::Add(const Sample& sample) {
+    for (auto& ring : levels_) {
+        ring.Add(sample);
+    }
+}
+
+const RollupRing* Rollups::Pick(int64_t step_ms, int64_t start_ms) const {
+    size_t chosen = LEVEL_COUNT;
+    for (size_t i = 0; i < LEVEL_COUNT; ++i) {
+        if (levels_[i].width() <= step_ms) {
+            chosen = i;
+        }
+    }
+    if (chosen == LEVEL_COUNT) {
+        return nullptr;
+    }
+    // 桶起点按桶宽对齐, 更粗的桶起点总是不晚于更细的, 不能只比起点. 没写满的分辨率保留着序列的第一条数据,
+    // 更粗的分辨率不会有更早的数据, 换过去只会让点变少
+    while (chosen + 1 < LEVEL_COUNT) {
+        const RollupRing& ring = levels_[chosen];
+        const RollupRing& coarser = levels_[chosen + 1];
+        if (ring.empty() || ring.at(0).start <= start_ms || !ring.full() ||
+            coarser.empty() || coarser.at(0).start >= ring.at(0).start) {
+            break;
+        }
+        ++chosen;
+    }
+    return &levels_[chosen];
+}
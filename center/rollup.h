@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "gorilla.h"
+
+// 一个时间桶内的聚合值, 平均值用sum/count算
+struct RollupBucket {
+    int64_t start; // 桶起始时间(毫秒), 按桶宽对齐
+    uint32_t count;
+    float cpu_min, cpu_max, cpu_sum;
+    float mem_min, mem_max, mem_sum;
+};
+
+// 同一个分辨率下的桶, 环形存放, 按需增长到capacity后覆盖最旧的桶
+class RollupRing {
+public:
+    RollupRing(int64_t width_ms, size_t capacity)
+        : width_ms_(width_ms), capacity_(capacity), head_(0) {}
+
+    // 新数据的时间戳必须不早于最后一个桶
+    void Add(const Sample& sample);
+    // 恢复快照时整桶写回
+    void PushBucket(const RollupBucket& bucket);
+    // 把和[start_ms, end_ms]有交集的桶按时间顺序追加到out, 二分定位起点, 只花返回的点数
+    void Query(int64_t start_ms, int64_t end_ms, std::vector<RollupBucket>* out) const;
+
+    int64_t width() const { return width_ms_; }
+    size_t size() const { return buf_.size(); }
+    bool empty() const { return buf_.empty(); }
+    // 写满后每个新桶都会覆盖最旧的桶, 最早的数据已经丢了
+    bool full() const { return buf_.size() == capacity_; }
+    // i = 0 是最旧的桶
+    const RollupBucket& at(size_t i) const { return buf_[(head_ + i) % buf_.size()]; }
+    const RollupBucket& back() const { return at(buf_.size() - 1); }
+
+private:
+    RollupBucket& mutable_back() { return buf_[(head_ + buf_.size() - 1) % buf_.size()]; }
+
+    int64_t width_ms_;
+    size_t capacity_;
+    std::vector<RollupBucket> buf_;
+    size_t head_;
+};
+
+// 一个序列所有分辨率的汇总: 10秒/1分钟/5分钟/1小时.
+// 每条数据到达时同时更新四个分辨率的当前桶, 查询大时间窗时不用再扫原始数据.
+class Rollups {
+public:
+    static constexpr size_t LEVEL_COUNT = 4;
+
+    Rollups();
+
+    void Add(const Sample& sample);
+    // 选出桶宽不超过step_ms的最粗分辨率; 它的历史不够覆盖start_ms, 并且更粗的分辨率确实保留了更早的数据时
+    // 再往更粗的找. 序列比查询窗口还新时不换, 返回部分覆盖.
+    // step_ms比最细的桶还小时返回nullptr, 这时应该直接查原始数据.
+    const RollupRing* Pick(int64_t step_ms, int64_t start_ms) const;
+
+    RollupRing& level(size_t i) { return levels_[i]; }
+    const RollupRing& level(size_t i) const { return levels_[i]; }
+
+private:
+    std::vector<RollupRing> levels_;
+};
@@ -0,0 +1,314 @@
+#include "wal.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "async_logging.h"
+
+namespace {
+
+const char* SEGMENT_PREFIX = "wal-";
+const char* SEGMENT_SUFFIX = ".log";
+const uint8_t RECORD_REGISTER = 2; // u32序列ID + u16名字长度 + 名字
+const uint8_t RECORD_SAMPLE = 3;   // u32序列ID + Sample
+
+uint32_t Checksum(const char* data, size_t len) {
+    // FNV-1a, 只用来发现段尾写了一半的记录
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; ++i) {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+template <typename T>
+void Put(std::string& buf, const T& value) {
+    buf.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool Get(const char*& ptr, const char* end, T* value) {
+    if (end - ptr < static_cast<ptrdiff_t>(sizeof(T))) {
+        return false;
+    }
+    std::memcpy(value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return true;
+}
+
+} // namespace
+
+std::vector<uint32_t> ListSequenceFiles(const std::string& dir, const std::string& prefix,
+                                        const std::string& suffix) {
+    std::vector<uint32_t> seqs;
+    DIR* d = opendir(dir.c_str());
+    if (d == nullptr) {
+        return seqs;
+    }
+    while (struct dirent* entry = readdir(d)) {
+        std::string name = entry->d_name;
+        if (name.size() <= prefix.size() + suffix.size() ||
+            name.compare(0, prefix.size(), prefix) != 0 ||
+            name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+            continue;
+        }
+        std::string digits = name.substr(prefix.size(), name.size() - prefix.size() - suffix.size());
+        if (std::all_of(digits.begin(), digits.end(), ::isdigit)) {
+            seqs.push_back(static_cast<uint32_t>(std::stoul(digits)));
+        }
+    }
+    closedir(d);
+    std::sort(seqs.begin(), seqs.end());
+    return seqs;
+}
+
+std::string SequenceFilePath(const std::string& dir, const std::string& prefix,
+                             uint32_t seq, const std::string& suffix) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%08u", seq);
+    return dir + "/" + prefix + buf + suffix;
+}
+
+WriteAheadLog::WriteAheadLog(const std::string& dir) : dir_(dir) {}
+
+WriteAheadLog::~WriteAheadLog() {
+    Close();
+}
+
+bool WriteAheadLog::Open() {
+    mkdir(dir_.c_str(), 0755);
+    std::vector<uint32_t> seqs = ListSequenceFiles(dir_, SEGMENT_PREFIX, SEGMENT_SUFFIX);
+    {
+        std::lock_guard<std::mutex> lock(file_mutex_);
+        // 已有的段只读不写, 重启后总是从一个新段开始
+        if (!OpenSegment(seqs.empty() ? 1 : seqs.back() + 1)) {
+            return false;
+        }
+    }
+    running_ = true;
+    writer_ = std::thread(&WriteAheadLog::WriterThread, this);
+    return true;
+}
+
+void WriteAheadLog::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    cond_.notify_one();
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+    std::lock_guard<std::mutex> lock(file_mutex_);
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool WriteAheadLog::OpenSegment(uint32_t seq) {
+    std::string path = SequenceFilePath(dir_, SEGMENT_PREFIX, seq, SEGMENT_SUFFIX);
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        ALOG(ERROR, "WAL: open %s failed: %s", path.c_str(), strerror(errno));
+        return false;
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+    fd_ = fd;
+    seq_ = seq;
+    segment_size_ = 0;
+    return true;
+}
+
+size_t WriteAheadLog::BeginRecord(uint32_t payload_len) {
+    size_t offset = pending_.size();
+    Put(pending_, payload_len);
+    Put(pending_, uint32_t(0)); // 校验和占位
+    return offset;
+}
+
+void WriteAheadLog::EndRecord(size_t offset, uint32_t payload_len) {
+    uint32_t checksum = Checksum(pending_.data() + offset + 8, payload_len);
+    std::memcpy(&pending_[offset + 4], &checksum, sizeof(checksum));
+}
+
+void WriteAheadLog::AppendRegister(uint32_t series_id, const std::string& server_name) {
+    uint32_t payload_len = static_cast<uint32_t>(1 + 4 + 2 + server_name.size());
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t offset = BeginRecord(payload_len);
+    Put(pending_, RECORD_REGISTER);
+    Put(pending_, series_id);
+    Put(pending_, static_cast<uint16_t>(server_name.size()));
+    pending_.append(server_name);
+    EndRecord(offset, payload_len);
+}
+
+void WriteAheadLog::Append(uint32_t series_id, const Sample& sample) {
+    // 数据记录只带ID, 定长25字节, 名字只在注册记录里写一次
+    uint32_t payload_len = static_cast<uint32_t>(1 + 4 + sizeof(Sample));
+
+    // 直接编码进pending_, 不为每条记录单独分配内存
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t offset = BeginRecord(payload_len);
+    Put(pending_, RECORD_SAMPLE);
+    Put(pending_, series_id);
+    Put(pending_, sample);
+    EndRecord(offset, payload_len);
+}
+
+void WriteAheadLog::AppendBatch(uint32_t series_id, const std::vector<Sample>& samples) {
+    uint32_t payload_len = static_cast<uint32_t>(1 + 4 + sizeof(Sample));
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const Sample& sample : samples) {
+        size_t offset = BeginRecord(payload_len);
+        Put(pending_, RECORD_SAMPLE);
+        Put(pending_, series_id);
+        Put(pending_, sample);
+        EndRecord(offset, payload_len);
+    }
+}
+
+void WriteAheadLog::WriterThread() {
+    std::string batch;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            // 攒一个周期的数据再刷盘, 一次fdatasync提交一整批
+            cond_.wait_for(lock, std::chrono::milliseconds(FLUSH_INTERVAL_MS),
+                           [this] { return !running_; });
+            batch.swap(pending_);
+            if (!running_ && batch.empty()) {
+                break;
+            }
+        }
+        if (!batch.empty()) {
+            std::lock_guard<std::mutex> lock(file_mutex_);
+            WriteAndSync(batch);
+            if (segment_size_ >= SEGMENT_BYTES) {
+                OpenSegment(seq_ + 1);
+            }
+        }
+        batch.clear();
+    }
+}
+
+void WriteAheadLog::WriteAndSync(const std::string& batch) {
+    if (fd_ < 0) {
+        return;
+    }
+    const char* ptr = batch.data();
+    size_t left = batch.size();
+    while (left > 0) {
+        ssize_t n = write(fd_, ptr, left);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            ALOG_EVERY_MS(ERROR, 1000, "WAL: write failed: %s", strerror(errno));
+            return;
+        }
+        ptr += n;
+        left -= n;
+    }
+    fdatasync(fd_);
+    segment_size_ += batch.size();
+}
+
+uint32_t WriteAheadLog::Rotate() {
+    std::string batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batch.swap(pending_);
+    }
+    // 写线程可能正拿着一批更早的记录, 等它写完再切段;
+    // 它若在切段之后才写, 那批记录会落到新段里, 重放时按时间戳去重, 不会丢数据.
+    std::lock_guard<std::mutex> lock(file_mutex_);
+    if (!batch.empty()) {
+        WriteAndSync(batch);
+    }
+    OpenSegment(seq_ + 1);
+    return seq_;
+}
+
+void WriteAheadLog::RemoveSegmentsBefore(uint32_t seq) {
+    for (uint32_t old : ListSequenceFiles(dir_, SEGMENT_PREFIX, SEGMENT_SUFFIX)) {
+        if (old >= seq) {
+            break;
+        }
+        unlink(SequenceFilePath(dir_, SEGMENT_PREFIX, old, SEGMENT_SUFFIX).c_str());
+    }
+}
+
+size_t WriteAheadLog::Replay(const std::string& dir, uint32_t from_seq, const ReplayHandler& handler) {
+    size_t records = 0;
+    for (uint32_t seq : ListSequenceFiles(dir, SEGMENT_PREFIX, SEGMENT_SUFFIX)) {
+        if (seq < from_seq) {
+            continue;
+        }
+        std::string path = SequenceFilePath(dir, SEGMENT_PREFIX, seq, SEGMENT_SUFFIX);
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            continue;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            close(fd);
+            continue;
+        }
+        void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (addr == MAP_FAILED) {
+            continue;
+        }
+
+        const char* ptr = static_cast<const char*>(addr);
+        const char* end = ptr + st.st_size;
+        std::string server_name;
+        while (true) {
+            uint32_t payload_len, checksum;
+            if (!Get(ptr, end, &payload_len) || !Get(ptr, end, &checksum) ||
+                end - ptr < static_cast<ptrdiff_t>(payload_len) ||
+                Checksum(ptr, payload_len) != checksum) {
+                break; // 段尾没写完整的记录
+            }
+            const char* payload = ptr;
+            const char* payload_end = ptr + payload_len;
+            ptr = payload_end;
+
+            uint8_t type;
+            uint32_t series_id;
+            uint16_t name_len;
+            Sample sample;
+            if (!Get(payload, payload_end, &type) || !Get(payload, payload_end, &series_id)) {
+                continue;
+            }
+            if (type == RECORD_SAMPLE) {
+                if (Get(payload, payload_end, &sample) && handler.on_sample) {
+                    handler.on_sample(series_id, sample);
+                    ++records;
+                }
+            } else if (type == RECORD_REGISTER) {
+                if (Get(payload, payload_end, &name_len) && payload_end - payload >= name_len &&
+                    handler.on_register) {
+                    server_name.assign(payload, name_len);
+                    handler.on_register(series_id, server_name);
+                }
+            }
+        }
+        munmap(addr, st.st_size);
+    }
+    return records;
+}
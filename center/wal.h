@@ -0,0 +1,82 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gorilla.h"
+
+// 列出dir下形如<prefix>00000001<suffix>的文件序号, 从小到大排列
+std::vector<uint32_t> ListSequenceFiles(const std::string& dir, const std::string& prefix,
+                                        const std::string& suffix);
+// 拼出<dir>/<prefix>00000001<suffix>
+std::string SequenceFilePath(const std::string& dir, const std::string& prefix,
+                             uint32_t seq, const std::string& suffix);
+
+// 分段的预写日志(WAL)
+// AddMetrics只把记录编码进内存缓冲区就返回, 专门的写线程把攒下来的一批记录
+// 一次write + 一次fdatasync落盘(group commit), IO线程不会被磁盘拖慢.
+// 代价是崩溃时可能丢掉最后一批(最多FLUSH_INTERVAL_MS毫秒)还没落盘的数据.
+//
+// 目录结构: <dir>/wal-00000001.log, wal-00000002.log, ...
+// 记录格式: [u32 payload长度][u32 校验和][payload]
+// payload第一个字节是记录类型: 注册记录(ID+名字)和按ID的数据记录
+class WriteAheadLog {
+public:
+    static constexpr size_t SEGMENT_BYTES = 64 * 1024 * 1024; // 单个段文件写满64MB换新段
+    static constexpr int FLUSH_INTERVAL_MS = 100;
+
+    struct ReplayHandler {
+        std::function<void(uint32_t series_id, const std::string& server_name)> on_register;
+        std::function<void(uint32_t series_id, const Sample& sample)> on_sample;
+    };
+
+    explicit WriteAheadLog(const std::string& dir);
+    ~WriteAheadLog();
+
+    // 在已有段之后新开一个段并启动写线程, 失败返回false
+    bool Open();
+    void Close();
+
+    // 注册记录必须先于这个ID的数据记录写入
+    void AppendRegister(uint32_t series_id, const std::string& server_name);
+    void Append(uint32_t series_id, const Sample& sample);
+    // 同一个序列的一批数据, 只加一次锁
+    void AppendBatch(uint32_t series_id, const std::vector<Sample>& samples);
+
+    // 把当前段写完并切换到新段, 返回新段的序号.
+    // 调用之前Append的记录都落在序号更小的段里.
+    uint32_t Rotate();
+    // 删除序号小于seq的段(已经被快照覆盖)
+    void RemoveSegmentsBefore(uint32_t seq);
+
+    // 按顺序重放序号不小于from_seq的所有段, 段尾写了一半的记录会被忽略. 返回重放的数据记录数
+    static size_t Replay(const std::string& dir, uint32_t from_seq, const ReplayHandler& handler);
+
+private:
+    void WriterThread();
+    // 调用方持有mutex_, 在pending_末尾追加一条记录头并返回它的起始位置
+    size_t BeginRecord(uint32_t payload_len);
+    void EndRecord(size_t offset, uint32_t payload_len);
+    // 调用方持有file_mutex_
+    bool OpenSegment(uint32_t seq);
+    void WriteAndSync(const std::string& batch);
+
+    const std::string dir_;
+
+    std::mutex mutex_; // 保护pending_
+    std::condition_variable cond_;
+    std::string pending_; // 还没交给写线程的编码后记录
+    bool running_ = false;
+
+    std::mutex file_mutex_; // 保护fd_和段信息
+    int fd_ = -1;
+    uint32_t seq_ = 0;
+    size_t segment_size_ = 0;
+
+    std::thread writer_;
+};
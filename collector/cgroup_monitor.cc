@@ -0,0 +1,279 @@
+#include "cgroup_monitor.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <dirent.h>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include "procfs_sampler.h"
+
+namespace {
+
+int64_t MonotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+const uint32_t WATCH_MASK = IN_CREATE | IN_DELETE | IN_ONLYDIR;
+
+// 在一行里找"key=数字", 找不到返回false
+bool FindKeyValue(const char* ptr, const char* end, const char* key, size_t key_len, uint64_t* value) {
+    while (ptr < end) {
+        while (ptr < end && *ptr == ' ') {
+            ++ptr;
+        }
+        if (procfs::StartsWith(ptr, end, key, key_len)) {
+            return procfs::ParseU64(ptr, end, value);
+        }
+        while (ptr < end && *ptr != ' ') {
+            ++ptr;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+CgroupMonitor::CgroupMonitor(const std::string& root, int max_depth)
+    : root_(root), max_depth_(max_depth), buf_(4096) {}
+
+CgroupMonitor::~CgroupMonitor() {
+    if (inotify_fd_ >= 0) {
+        close(inotify_fd_);
+    }
+    if (root_fd_ >= 0) {
+        close(root_fd_);
+    }
+}
+
+bool CgroupMonitor::Open() {
+    root_fd_ = open(root_.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    // cgroup v2的根目录下才有cgroup.controllers
+    if (root_fd_ < 0 || faccessat(root_fd_, "cgroup.controllers", R_OK, 0) != 0) {
+        return false;
+    }
+    inotify_fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd_ < 0) {
+        std::cerr << "inotify_init1 failed: " << strerror(errno) << std::endl;
+        return false;
+    }
+    // 根cgroup就是整台主机, 已经有主机级的指标, 只监视不上报
+    root_wd_ = inotify_add_watch(inotify_fd_, root_.c_str(), WATCH_MASK);
+    if (root_wd_ < 0) {
+        std::cerr << "inotify_add_watch " << root_ << " failed: " << strerror(errno) << std::endl;
+        return false;
+    }
+    Rescan();
+    return true;
+}
+
+void CgroupMonitor::Rescan() {
+    for (const auto& cgroup : cgroups_) {
+        if (cgroup->wd >= 0) {
+            inotify_rm_watch(inotify_fd_, cgroup->wd);
+        }
+    }
+    cgroups_.clear();
+    by_wd_.clear();
+    DIR* dir = opendir(root_.c_str());
+    if (dir == nullptr) {
+        return;
+    }
+    std::vector<std::string> children;
+    while (struct dirent* entry = readdir(dir)) {
+        if (entry->d_type == DT_DIR && entry->d_name[0] != '.') {
+            children.emplace_back(entry->d_name);
+        }
+    }
+    closedir(dir);
+    std::sort(children.begin(), children.end());
+    for (const auto& child : children) {
+        AddTree(child, 1);
+    }
+}
+
+void CgroupMonitor::AddTree(const std::string& path, int depth) {
+    if (depth > max_depth_) {
+        return;
+    }
+    std::string full = root_ + "/" + path;
+    // 先加监视再列目录, 中间新建的子目录要么列得到, 要么有事件; 两边都有时按路径去重
+    int wd = depth < max_depth_ ? inotify_add_watch(inotify_fd_, full.c_str(), WATCH_MASK) : -1;
+    for (const auto& cgroup : cgroups_) {
+        if (cgroup->path == path) {
+            return;
+        }
+    }
+    auto cgroup = std::make_unique<Cgroup>();
+    cgroup->path = path;
+    cgroup->depth = depth;
+    cgroup->wd = wd;
+    if (wd >= 0) {
+        by_wd_[wd] = cgroup.get();
+    }
+    cgroups_.push_back(std::move(cgroup));
+    if (wd < 0) {
+        return;
+    }
+
+    DIR* dir = opendir(full.c_str());
+    if (dir == nullptr) {
+        return;
+    }
+    std::vector<std::string> children;
+    while (struct dirent* entry = readdir(dir)) {
+        if (entry->d_type == DT_DIR && entry->d_name[0] != '.') {
+            children.emplace_back(entry->d_name);
+        }
+    }
+    closedir(dir);
+    std::sort(children.begin(), children.end());
+    for (const auto& child : children) {
+        AddTree(path + "/" + child, depth + 1);
+    }
+}
+
+void CgroupMonitor::RemovePath(const std::string& path) {
+    // cgroup要先删空子cgroup才能删, 这里一起清掉只是防止漏了事件
+    const std::string prefix = path + "/";
+    auto removed = [&](const std::unique_ptr<Cgroup>& cgroup) {
+        if (cgroup->path != path && cgroup->path.compare(0, prefix.size(), prefix) != 0) {
+            return false;
+        }
+        // 目录删掉后内核自己移除监视, 不用inotify_rm_watch
+        if (cgroup->wd >= 0) {
+            by_wd_.erase(cgroup->wd);
+        }
+        return true;
+    };
+    cgroups_.erase(std::remove_if(cgroups_.begin(), cgroups_.end(), removed), cgroups_.end());
+}
+
+void CgroupMonitor::DrainEvents() {
+    alignas(struct inotify_event) char events[8192];
+    bool overflow = false;
+    while (true) {
+        ssize_t n = read(inotify_fd_, events, sizeof(events));
+        if (n <= 0) {
+            break;
+        }
+        for (ssize_t offset = 0; offset < n;) {
+            const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(events + offset);
+            offset += sizeof(struct inotify_event) + event->len;
+            if (event->mask & IN_Q_OVERFLOW) {
+                overflow = true;
+                continue;
+            }
+            if (!(event->mask & IN_ISDIR) || event->len == 0) {
+                continue;
+            }
+            // 子目录的路径: 根目录下的直接是名字, 其余的接在父cgroup后面
+            std::string path;
+            int depth = 1;
+            if (event->wd != root_wd_) {
+                auto parent = by_wd_.find(event->wd);
+                if (parent == by_wd_.end()) {
+                    continue;
+                }
+                path = parent->second->path + "/";
+                depth = parent->second->depth + 1;
+            }
+            path += event->name;
+            if (event->mask & IN_CREATE) {
+                AddTree(path, depth);
+            } else if (event->mask & IN_DELETE) {
+                RemovePath(path);
+            }
+        }
+    }
+    // 事件丢了就不知道少了哪些变化, 重新遍历一次
+    if (overflow) {
+        Rescan();
+    }
+}
+
+bool CgroupMonitor::ReadFile(const std::string& path, const char* file) {
+    std::string name = path + "/" + file;
+    int fd = openat(root_fd_, name.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    while (true) {
+        ssize_t n = pread(fd, buf_.data(), buf_.size(), 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n >= 0 && static_cast<size_t>(n) == buf_.size()) {
+            buf_.resize(buf_.size() * 2);
+            continue;
+        }
+        close(fd);
+        size_ = n < 0 ? 0 : static_cast<size_t>(n);
+        return n >= 0;
+    }
+}
+
+void CgroupMonitor::Collect(std::vector<CgroupSample>* out) {
+    out->clear();
+    if (inotify_fd_ < 0) {
+        return;
+    }
+    DrainEvents();
+
+    int64_t now = MonotonicNs();
+    double seconds = prev_ns_ == 0 ? 0.0 : (now - prev_ns_) / 1e9;
+    prev_ns_ = now;
+    static const char USAGE_KEY[] = "usage_usec";
+    static const char RBYTES_KEY[] = "rbytes=";
+    static const char WBYTES_KEY[] = "wbytes=";
+    for (const auto& cgroup : cgroups_) {
+        CgroupSample sample{cgroup->path, 0, 0, 0, 0};
+        uint64_t usage_usec = 0, read_bytes = 0, write_bytes = 0;
+        // cpu.stat第一行: usage_usec 123456
+        if (ReadFile(cgroup->path, "cpu.stat")) {
+            const char* ptr = buf_.data();
+            const char* end = ptr + size_;
+            if (procfs::StartsWith(ptr, end, USAGE_KEY, sizeof(USAGE_KEY) - 1)) {
+                procfs::ParseU64(ptr, end, &usage_usec);
+            }
+        }
+        if (ReadFile(cgroup->path, "memory.current")) {
+            const char* ptr = buf_.data();
+            procfs::ParseU64(ptr, ptr + size_, &sample.memory_bytes);
+        }
+        // io.stat每个设备一行: 8:0 rbytes=1 wbytes=2 rios=3 wios=4 dbytes=0 dios=0
+        if (ReadFile(cgroup->path, "io.stat")) {
+            const char* ptr = buf_.data();
+            const char* end = ptr + size_;
+            while (ptr < end) {
+                const char* line = ptr;
+                procfs::SkipLine(ptr, end);
+                uint64_t value;
+                if (FindKeyValue(line, ptr, RBYTES_KEY, sizeof(RBYTES_KEY) - 1, &value)) {
+                    read_bytes += value;
+                }
+                if (FindKeyValue(line, ptr, WBYTES_KEY, sizeof(WBYTES_KEY) - 1, &value)) {
+                    write_bytes += value;
+                }
+            }
+        }
+        // 计数回退(比如cgroup被删了又用同名重建)时这一次报0
+        if (cgroup->has_prev && seconds > 0 && usage_usec >= cgroup->prev_usage_usec &&
+            read_bytes >= cgroup->prev_read_bytes && write_bytes >= cgroup->prev_write_bytes) {
+            sample.cpu_usage = static_cast<float>((usage_usec - cgroup->prev_usage_usec) / (seconds * 1e4));
+            sample.io_read_bps = static_cast<float>((read_bytes - cgroup->prev_read_bytes) / seconds);
+            sample.io_write_bps = static_cast<float>((write_bytes - cgroup->prev_write_bytes) / seconds);
+        }
+        cgroup->has_prev = true;
+        cgroup->prev_usage_usec = usage_usec;
+        cgroup->prev_read_bytes = read_bytes;
+        cgroup->prev_write_bytes = write_bytes;
+        out->push_back(std::move(sample));
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 一个cgroup在上报周期内的资源占用
+struct CgroupSample {
+    std::string path; // 相对cgroup根目录, 比如system.slice/docker-xxx.scope
+    float cpu_usage;  // 相对一个核的百分比
+    uint64_t memory_bytes;
+    float io_read_bps;
+    float io_write_bps;
+};
+
+// cgroup v2的容器级指标: 读每个cgroup的cpu.stat, memory.current和io.stat.
+// 启动时遍历一次目录树, 之后靠inotify的创建/删除事件增量维护cgroup列表, 不用每次重新遍历.
+// 控制文件每次相对根目录的dirfd用openat读完就关, 几百个容器也不会占满文件描述符.
+class CgroupMonitor {
+public:
+    CgroupMonitor(const std::string& root, int max_depth);
+    ~CgroupMonitor();
+    CgroupMonitor(const CgroupMonitor&) = delete;
+    CgroupMonitor& operator=(const CgroupMonitor&) = delete;
+
+    // 根目录不是cgroup v2时返回false
+    bool Open();
+    // 先处理积攒的inotify事件, 再读每个cgroup; 速率是和上一次调用之间的平均值
+    void Collect(std::vector<CgroupSample>* out);
+    size_t size() const { return cgroups_.size(); }
+
+private:
+    struct Cgroup {
+        std::string path;
+        int depth;
+        int wd; // inotify监视描述符, 到了最大深度不再往下看的目录是-1
+        bool has_prev = false;
+        uint64_t prev_usage_usec = 0;
+        uint64_t prev_read_bytes = 0;
+        uint64_t prev_write_bytes = 0;
+    };
+
+    // 加入path以及它下面max_depth以内的所有cgroup
+    void AddTree(const std::string& path, int depth);
+    // 去掉path和它下面的所有cgroup
+    void RemovePath(const std::string& path);
+    void DrainEvents();
+    void Rescan();
+    // 读出相对根目录的文件到buf_, 失败返回false
+    bool ReadFile(const std::string& path, const char* file);
+
+    const std::string root_;
+    const int max_depth_;
+    int root_fd_ = -1;
+    int inotify_fd_ = -1;
+    int root_wd_ = -1;
+    std::vector<std::unique_ptr<Cgroup>> cgroups_; // 按发现顺序, 上报顺序稳定
+    std::unordered_map<int, Cgroup*> by_wd_;
+    std::vector<char> buf_;
+    size_t size_ = 0;
+    int64_t prev_ns_ = 0;
+};
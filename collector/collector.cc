@@ -1,74 +1,89 @@
+#include <algorithm>
+#include <atomic>
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <string>
 #include <unistd.h>
 #include <thread>
 #include <chrono>
 #include "Krpcapplication.h"
 #include "monitor.pb.h"
+#include "backoff_channel.h"
+#include "cgroup_monitor.h"
+#include "process_scanner.h"
+#include "procfs_sampler.h"
+#include "report_batcher.h"
+#include "self_governor.h"
+#include "spill_queue.h"
+#include "spsc_ring.h"
+#include "tick_scheduler.h"
 
 // 系统监控类
 class SystemMonitor {
 public:
-    // 获取CPU使用率
-    float GetCpuUsage() {
-        static unsigned long long prev_total = 0;
-        static unsigned long long prev_idle = 0;
-        
-        std::ifstream stat_file("/proc/stat");
-        std::string line;
-        std::getline(stat_file, line);
-        stat_file.close();
-        
-        std::istringstream ss(line);
-        std::string cpu;
-        unsigned long long user, nice, system, idle, iowait, irq, softirq, steal;
-        ss >> cpu >> user >> nice >> system >> idle >> iowait >> irq >> softirq >> steal;
-        
-        unsigned long long total = user + nice + system + idle + iowait + irq + softirq + steal;
-        unsigned long long total_idle = idle + iowait;
-        
-        float usage = 0.0;
-        if (prev_total != 0) {
-            unsigned long long total_diff = total - prev_total;
-            unsigned long long idle_diff = total_idle - prev_idle;
-            if (total_diff > 0) {
-                usage = 100.0 * (total_diff - idle_diff) / total_diff;
-            }
+    SystemMonitor(const std::string& proc_root, size_t top_processes, std::chrono::milliseconds scan_budget,
+                  const std::string& cgroup_root, int cgroup_depth)
+        : sampler_(proc_root), scanner_(proc_root), top_processes_(top_processes), scan_budget_(scan_budget),
+          cgroups_(cgroup_root, cgroup_depth) {
+        if (!sampler_.Open()) {
+            std::cerr << "Cannot open " << proc_root << "/stat or " << proc_root << "/meminfo" << std::endl;
+        }
+        if (top_processes_ > 0 && !scanner_.Open()) {
+            std::cerr << "Cannot open " << proc_root << " for process scanning" << std::endl;
+        }
+        if (cgroup_depth > 0 && !cgroups_.Open()) {
+            std::cerr << cgroup_root << " is not a cgroup v2 hierarchy, container metrics disabled" << std::endl;
         }
-        
-        prev_total = total;
-        prev_idle = total_idle;
-        
-        return usage;
     }
+
+    // 获取CPU使用率
+    float GetCpuUsage() { return sampler_.CpuUsage(); }
     
     // 获取内存使用率
-    float GetMemoryUsage() {
-        std::ifstream meminfo("/proc/meminfo");
-        std::string line;
-        unsigned long long mem_total = 0, mem_available = 0;
-        
-        while (std::getline(meminfo, line)) {
-            std::istringstream ss(line);
-            std::string key;
-            unsigned long long value;
-            ss >> key >> value;
-            
-            if (key == "MemTotal:") {
-                mem_total = value;
-            } else if (key == "MemAvailable:") {
-                mem_available = value;
-                break;
-            }
+    float GetMemoryUsage() { return sampler_.MemoryUsage(); }
+
+    // 每个核的使用率(取自最近一次GetCpuUsage), loadavg, 磁盘和网卡速率, 占用最高的进程和各个cgroup, 填进同一条MetricsData
+    void FillExtended(dmonitor::MetricsData* metrics) {
+        sampler_.CollectExtended(&extended_);
+        for (float usage : extended_.core_usage) {
+            metrics->add_core_usage(usage);
+        }
+        metrics->set_load1(extended_.load1);
+        metrics->set_load5(extended_.load5);
+        metrics->set_load15(extended_.load15);
+        for (const auto& disk : extended_.disks) {
+            metrics->add_disk_names(disk.name);
+            metrics->add_disk_read_bps(disk.in_bps);
+            metrics->add_disk_write_bps(disk.out_bps);
         }
-        meminfo.close();
-        
-        if (mem_total > 0) {
-            return 100.0 * (mem_total - mem_available) / mem_total;
+        for (const auto& net : extended_.nets) {
+            metrics->add_net_names(net.name);
+            metrics->add_net_rx_bps(net.in_bps);
+            metrics->add_net_tx_bps(net.out_bps);
+        }
+        if (top_processes_ > 0 && scan_processes_) {
+            metrics->set_processes_truncated(!scanner_.Scan(top_processes_, scan_budget_, &top_cpu_, &top_rss_));
+            AddProcesses(top_cpu_, metrics->mutable_top_cpu());
+            AddProcesses(top_rss_, metrics->mutable_top_rss());
+        }
+        if (collect_cgroups_) {
+            cgroups_.Collect(&cgroup_samples_);
+        } else {
+            cgroup_samples_.clear();
+        }
+        for (const auto& sample : cgroup_samples_) {
+            dmonitor::CgroupInfo* cgroup = metrics->add_cgroups();
+            cgroup->set_path(sample.path);
+            cgroup->set_cpu_usage(sample.cpu_usage);
+            cgroup->set_memory_bytes(sample.memory_bytes);
+            cgroup->set_io_read_bps(sample.io_read_bps);
+            cgroup->set_io_write_bps(sample.io_write_bps);
         }
-        return 0.0;
+    }
+    
+    // 自身开销超预算时关掉代价高的采集项
+    void SetProbes(bool scan_processes, bool collect_cgroups) {
+        scan_processes_ = scan_processes;
+        collect_cgroups_ = collect_cgroups;
     }
     
     // 获取主机名
@@ -86,47 +101,302 @@ public:
         auto duration = now.time_since_epoch();
         return std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
     }
+
+private:
+    static void AddProcesses(const std::vector<ProcessSample>& processes,
+                             google::protobuf::RepeatedPtrField<dmonitor::ProcessInfo>* out) {
+        for (const auto& process : processes) {
+            dmonitor::ProcessInfo* info = out->Add();
+            info->set_pid(process.pid);
+            info->set_name(process.name);
+            info->set_cpu_usage(process.cpu_usage);
+            info->set_rss_bytes(process.rss_bytes);
+        }
+    }
+
+    ProcfsSampler sampler_;
+    ExtendedSample extended_;
+    ProcessScanner scanner_;
+    const size_t top_processes_;
+    const std::chrono::milliseconds scan_budget_;
+    std::vector<ProcessSample> top_cpu_, top_rss_;
+    CgroupMonitor cgroups_;
+    std::vector<CgroupSample> cgroup_samples_;
+    bool scan_processes_ = true;
+    bool collect_cgroups_ = true;
+};
+
+// 用主机名向center换一个序列ID, 失败时返回false, 之后按名字上报
+bool RegisterSeries(dmonitor::MonitorReportServiceRpc_Stub& stub, const std::string& hostname,
+                    uint32_t* series_id, uint64_t* incarnation)
+{
+    dmonitor::RegisterRequest req;
+    dmonitor::RegisterResponse rsp;
+    Krpccontroller controller;
+    req.set_server_name(hostname);
+    stub.Register(&controller, &req, &rsp, nullptr);
+    if (controller.Failed() || !rsp.success()) {
+        std::cerr << "Register failed: "
+                  << (controller.Failed() ? controller.ErrorText() : rsp.result().errmsg()) << std::endl;
+        *series_id = 0;
+        return false;
+    }
+    *series_id = rsp.series_id();
+    *incarnation = rsp.incarnation();
+    std::cout << "Registered as series " << *series_id << std::endl;
+    return true;
+}
+
+// 发送线程: 独占stub, 从环形队列取采样线程攒好的批次发给center.
+// center连不上时批次写进磁盘队列, 恢复后按原来的顺序限速补发, 补发完之前新批次也排在队尾.
+// 重连的节奏由BackoffChannel的退避决定.
+class ReportSender {
+public:
+    ReportSender(const std::string& hostname, SpscRing<dmonitor::ReportBatchRequest>* ring,
+                 SpillQueue* spill, int replay_per_sec, std::chrono::milliseconds reconnect_base,
+                 std::chrono::milliseconds reconnect_max, std::atomic<bool>* resync)
+        : hostname_(hostname), ring_(ring), spill_(spill), channel_(reconnect_base, reconnect_max), stub_(&channel_),
+          replay_gap_(std::chrono::milliseconds(1000 / std::max(replay_per_sec, 1))), resync_(resync) {}
+
+    void Run() {
+        RegisterSeries(stub_, hostname_, &series_id_, &incarnation_);
+        dmonitor::ReportBatchRequest batch;
+        auto next_replay = std::chrono::steady_clock::now();
+        while (true) {
+            bool idle = true;
+            if (ring_->TryPop(&batch)) {
+                idle = false;
+                if (!online_ || !spill_->empty()) {
+                    Spill(batch);
+                } else if (Send(&batch) == SendResult::UNREACHABLE) {
+                    online_ = false;
+                    Spill(batch);
+                }
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            // 离线时等channel的退避结束再试, 退避期间不去碰center
+            if (!spill_->empty() && now >= next_replay && (online_ || !channel_.backing_off())) {
+                idle = false;
+                if (!spill_->Front(&record_) || !batch.ParseFromString(record_)) {
+                    spill_->Pop();
+                    continue;
+                }
+                if (Send(&batch) == SendResult::UNREACHABLE) {
+                    online_ = false;
+                } else {
+                    if (!online_) {
+                        const BackoffChannel::Stats& stats = channel_.stats();
+                        std::cout << "Center reachable again, replaying " << spill_->count()
+                                  << " spilled batches (calls=" << stats.calls << " dials=" << stats.dials
+                                  << " failures=" << stats.failures << " backed_off=" << stats.backed_off
+                                  << ")" << std::endl;
+                        online_ = true;
+                    }
+                    // 被center拒绝的批次重发也没用, 和发成功的一样出队
+                    spill_->Pop();
+                    next_replay = now + replay_gap_;
+                }
+            }
+
+            if (idle) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_WAIT_MS));
+            }
+        }
+    }
+
+private:
+    enum class SendResult { OK, REJECTED, UNREACHABLE };
+
+    static constexpr int IDLE_WAIT_MS = 50;
+
+    SendResult Send(dmonitor::ReportBatchRequest* req) {
+        // 注册过就只带ID, 否则按名字上报; 补发的批次也用现在的ID
+        req->set_server_name(series_id_ == 0 ? hostname_ : std::string());
+        req->set_series_id(series_id_);
+        req->set_incarnation(incarnation_);
+
+        dmonitor::ReportResponse rsp;
+        Krpccontroller controller;
+        stub_.ReportBatch(&controller, req, &rsp, nullptr);
+        // center重启过, ID已经失效: 重新注册后把这一批再发一次
+        if (!controller.Failed() && !rsp.success() && rsp.result().errcode() == 2) {
+            RegisterSeries(stub_, hostname_, &series_id_, &incarnation_);
+            // 新的center没有之前的值, 死区模式下要让采样线程再报一个完整的点
+            resync_->store(true, std::memory_order_relaxed);
+            req->set_server_name(series_id_ == 0 ? hostname_ : std::string());
+            req->set_series_id(series_id_);
+            req->set_incarnation(incarnation_);
+            rsp.Clear();
+            controller.Reset();
+            stub_.ReportBatch(&controller, req, &rsp, nullptr);
+        }
+
+        if (controller.Failed()) {
+            if (online_) {
+                std::cerr << "Center unreachable, spilling to disk: " << controller.ErrorText() << std::endl;
+            }
+            return SendResult::UNREACHABLE;
+        }
+        if (!rsp.success()) {
+            std::cerr << "Report failed: " << rsp.result().errmsg() << std::endl;
+            return SendResult::REJECTED;
+        }
+        if (req->timestamp_deltas_size() == 0) {
+            std::cout << "[" << req->sampled_until() << "] Heartbeat" << std::endl;
+        } else {
+            std::cout << "[" << req->sampled_until() << "] Reported " << req->timestamp_deltas_size()
+                      << " samples" << std::endl;
+        }
+        return SendResult::OK;
+    }
+
+    void Spill(const dmonitor::ReportBatchRequest& batch) {
+        uint64_t dropped = spill_->dropped();
+        if (!batch.SerializeToString(&record_) || !spill_->Push(record_)) {
+            std::cerr << "Cannot spill batch, " << batch.timestamp_deltas_size() << " samples lost" << std::endl;
+        } else if (spill_->dropped() != dropped) {
+            std::cerr << "Spill file full, dropped " << spill_->dropped() - dropped << " oldest batches" << std::endl;
+        }
+    }
+
+    const std::string hostname_;
+    SpscRing<dmonitor::ReportBatchRequest>* ring_;
+    SpillQueue* spill_;
+    BackoffChannel channel_; // 要在stub_之前构造
+    dmonitor::MonitorReportServiceRpc_Stub stub_;
+    const std::chrono::milliseconds replay_gap_;
+    std::atomic<bool>* resync_;
+    uint32_t series_id_ = 0;
+    uint64_t incarnation_ = 0;
+    bool online_ = true;
+    std::string record_; // 序列化和读盘复用的缓冲区
 };
 
+// 采样线程和发送线程之间最多排队的批次, 发送线程卡住时采样线程继续往当前批次里攒
+const size_t SEND_QUEUE_BATCHES = 16;
+
 int main(int argc, char* argv[])
 {
     KrpcApplication::Init(argc, argv);
     
-    SystemMonitor monitor;
-    dmonitor::MonitorReportServiceRpc_Stub stub(new KrpcChannel(false));
+    // procroot可以指向录好的/proc目录, 不配置就读本机的/proc
+    std::string proc_root = KrpcApplication::GetConfig().Load("procroot");
+    // 每批上报带上CPU和内存占用最高的几个进程, 0表示不扫描; 扫描超过预算就只报扫到的部分
+    std::string top_processes = KrpcApplication::GetConfig().Load("topprocesses");
+    std::string scan_budget = KrpcApplication::GetConfig().Load("procscanbudgetms");
+    // cgroup v2的容器级指标, 只看根目录下cgroupdepth层以内的cgroup, 0表示不采集
+    std::string cgroup_root = KrpcApplication::GetConfig().Load("cgrouproot");
+    std::string cgroup_depth = KrpcApplication::GetConfig().Load("cgroupdepth");
+    SystemMonitor monitor(proc_root.empty() ? "/proc" : proc_root,
+                          top_processes.empty() ? 5 : std::stoi(top_processes),
+                          std::chrono::milliseconds(scan_budget.empty() ? 20 : std::stoi(scan_budget)),
+                          cgroup_root.empty() ? "/sys/fs/cgroup" : cgroup_root,
+                          cgroup_depth.empty() ? 3 : std::stoi(cgroup_depth));
     
     std::string hostname = monitor.GetHostname();
     std::cout << "Collector started for server: " << hostname << std::endl;
+
+    // 采样间隔和上报间隔: 高频采样看得到秒级以下的尖峰, 攒成一批再上报, RPC次数不变
+    std::string sample_interval = KrpcApplication::GetConfig().Load("sampleintervalms");
+    std::string report_interval = KrpcApplication::GetConfig().Load("reportintervalsec");
+    auto sample_period = std::chrono::milliseconds(sample_interval.empty() ? 250 : std::stoi(sample_interval));
+    auto report_period = std::chrono::seconds(report_interval.empty() ? 3 : std::stoi(report_interval));
+
+    // center连不上时的磁盘队列
+    std::string spill_file = KrpcApplication::GetConfig().Load("spillfile");
+    std::string spill_max_mb = KrpcApplication::GetConfig().Load("spillmaxmb");
+    std::string replay_per_sec = KrpcApplication::GetConfig().Load("spillreplaypersec");
+    SpillQueue spill;
+    spill.Open(spill_file.empty() ? "./collector.spill" : spill_file,
+               static_cast<size_t>(spill_max_mb.empty() ? 64 : std::stoi(spill_max_mb)) << 20);
+
+    // 死区模式: CPU和内存都没变超过deadband个百分点的采样不上报, 每heartbeatsec至少发一次心跳.
+    // 心跳间隔要小于center判定离线的10秒
+    std::string deadband = KrpcApplication::GetConfig().Load("deadband");
+    std::string heartbeat = KrpcApplication::GetConfig().Load("heartbeatsec");
+    auto heartbeat_period = std::chrono::seconds(heartbeat.empty() ? 5 : std::stoi(heartbeat));
+
+    SpscRing<dmonitor::ReportBatchRequest> ring(SEND_QUEUE_BATCHES);
+    std::atomic<bool> resync{false};
+    // 连不上center时重连的退避: 从reconnectbasems开始每次翻倍, 最多reconnectmaxms, 再加随机抖动
+    std::string reconnect_base = KrpcApplication::GetConfig().Load("reconnectbasems");
+    std::string reconnect_max = KrpcApplication::GetConfig().Load("reconnectmaxms");
+    ReportSender sender(hostname, &ring, &spill, replay_per_sec.empty() ? 10 : std::stoi(replay_per_sec),
+                        std::chrono::milliseconds(reconnect_base.empty() ? 500 : std::stoi(reconnect_base)),
+                        std::chrono::milliseconds(reconnect_max.empty() ? 30000 : std::stoi(reconnect_max)),
+                        &resync);
+    std::thread sender_thread([&sender]() { sender.Run(); });
+
+    // 所有主机都对齐到上报间隔的边界, 再按主机名错开各自的相位,
+    // 同时启动的一批collector不会在同一时刻一起打到center
+    TickScheduler ticker;
+    ticker.Start(sample_period, report_period, TickScheduler::HostPhase(hostname, report_period));
+    const uint64_t ticks_per_report = std::max<uint64_t>(1, report_period / sample_period);
+
+    // collector自身开销的预算: CPU是相对一个核的百分比, 超了就逐级少采
+    std::string cpu_budget = KrpcApplication::GetConfig().Load("selfcpubudget");
+    std::string rss_budget = KrpcApplication::GetConfig().Load("selfrssbudgetmb");
+    SelfGovernor governor(cpu_budget.empty() ? 2.0f : std::stof(cpu_budget),
+                          static_cast<uint64_t>(rss_budget.empty() ? 64 : std::stoi(rss_budget)) << 20);
+
+    ReportBatcher batcher(deadband.empty() ? 0 : std::stof(deadband));
+    dmonitor::ReportBatchRequest req;
+    uint64_t ticks = 0;
+    uint64_t sample_ticks = 0;
+    int64_t sampled_at = 0;
+    auto next_heartbeat = std::chrono::steady_clock::now();
+    monitor.GetCpuUsage(); // 第一次只记下基准
     
-    // 定时上报循环
+    // 采样循环, 发RPC在发送线程, center慢或者挂了都不影响采样节奏
     while (true) {
-        dmonitor::ReportRequest req;
-        dmonitor::ReportResponse rsp;
-        
-        // 采集系统指标
-        float cpu_usage = monitor.GetCpuUsage();
-        float memory_usage = monitor.GetMemoryUsage();
-        int64_t timestamp = monitor.GetTimestamp();
-        
-        // 填充请求
-        req.mutable_metrics()->set_server_name(hostname);
-        req.mutable_metrics()->set_timestamp(timestamp);
-        req.mutable_metrics()->set_cpu_usage(cpu_usage);
-        req.mutable_metrics()->set_memory_usage(memory_usage);
-        
-        // 发送RPC请求
-        stub.Report(nullptr, &req, &rsp, nullptr);
-        
-        if (rsp.success()) {
-            std::cout << "[" << timestamp << "] Reported: CPU=" << cpu_usage 
-                      << "%, Memory=" << memory_usage << "%" << std::endl;
-        } else {
-            std::cerr << "Report failed: " << rsp.result().errmsg() << std::endl;
+        // 错过的触发不补采, 只算进上报的节拍里
+        uint64_t expired = ticker.Wait();
+        ticks += expired;
+        if (resync.exchange(false, std::memory_order_relaxed)) {
+            batcher.ForceNext();
+        }
+
+        // 采集系统指标; 降级时隔几个节拍才采一次, 上报的节拍不变
+        sample_ticks += expired;
+        if (sample_ticks >= governor.sample_stride()) {
+            sample_ticks = 0;
+            float cpu_usage = monitor.GetCpuUsage();
+            float memory_usage = monitor.GetMemoryUsage();
+            sampled_at = monitor.GetTimestamp();
+            batcher.Add(sampled_at, cpu_usage, memory_usage);
+        }
+        // 队列满了就先不交, 这一批继续攒着, 下一个采样点再试
+        if (ticks < ticks_per_report || ring.full()) {
+            continue;
+        }
+        ticks = 0;
+        governor.Update();
+        monitor.SetProbes(governor.scan_processes(), governor.collect_cgroups());
+        // 死区模式下整批都没有变化, 到了心跳间隔才发一个空批次
+        auto now = std::chrono::steady_clock::now();
+        if (batcher.empty() && now < next_heartbeat) {
+            continue;
+        }
+        next_heartbeat = now + heartbeat_period;
+
+        int64_t last_timestamp = batcher.last_timestamp();
+        batcher.Take(&req);
+        req.set_sampled_until(sampled_at);
+        // 扩展指标每批采一次, 挂在最后一个点上; 心跳没有点, 挂在sampled_until上,
+        // 死区模式下CPU和内存不变时负载/磁盘/网络/进程照样按心跳更新
+        int64_t extended_at = last_timestamp != 0 ? last_timestamp : sampled_at;
+        if (extended_at != 0) {
+            dmonitor::MetricsData* extended = req.mutable_extended();
+            extended->set_timestamp(extended_at);
+            monitor.FillExtended(extended);
+            extended->set_collector_cpu_usage(governor.cpu_usage());
+            extended->set_collector_rss_bytes(governor.rss_bytes());
+            extended->set_collector_throttle_level(governor.level());
         }
-        
-        // 等待3秒
-        std::this_thread::sleep_for(std::chrono::seconds(3));
+        ring.TryPush(std::move(req));
     }
     
+    sender_thread.join();
     return 0;
-}
\ No newline at end of file
+}
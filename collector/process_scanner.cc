@@ -0,0 +1,274 @@
+#include "process_scanner.h"
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "procfs_sampler.h"
+
+namespace {
+
+int64_t MonotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+// getdents64返回的记录格式, glibc老版本没有导出
+struct LinuxDirent64 {
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+
+const size_t DIRENTS_BUFFER = 32768;
+// 每扫这么多个进程看一次时间, 不用每个都调clock_gettime
+const size_t BUDGET_CHECK_EVERY = 64;
+
+// 目录名全是数字才是进程, 顺便解析出pid
+bool ParsePid(const char* name, int32_t* pid) {
+    int32_t value = 0;
+    if (*name == '\0') {
+        return false;
+    }
+    for (; *name != '\0'; ++name) {
+        if (*name < '0' || *name > '9') {
+            return false;
+        }
+        value = value * 10 + (*name - '0');
+    }
+    *pid = value;
+    return true;
+}
+
+size_t Hash(int32_t pid) {
+    return static_cast<uint32_t>(pid) * 2654435761u;
+}
+
+} // namespace
+
+void PidTicksMap::Clear() {
+    std::fill(entries_.begin(), entries_.end(), Entry{0, 0, 0});
+    size_ = 0;
+}
+
+void PidTicksMap::Grow() {
+    std::vector<Entry> old(std::max<size_t>(entries_.size() * 2, 1024));
+    old.swap(entries_);
+    size_ = 0;
+    for (const Entry& entry : old) {
+        if (entry.pid != 0) {
+            Put(entry.pid, entry.ticks, entry.scan_ns);
+        }
+    }
+}
+
+void PidTicksMap::Put(int32_t pid, uint64_t ticks, int64_t scan_ns) {
+    // 负载不超过1/2, 探测链很短
+    if ((size_ + 1) * 2 > entries_.size()) {
+        Grow();
+    }
+    size_t mask = entries_.size() - 1;
+    for (size_t i = Hash(pid) & mask;; i = (i + 1) & mask) {
+        if (entries_[i].pid == pid) {
+            entries_[i].ticks = ticks;
+            entries_[i].scan_ns = scan_ns;
+            return;
+        }
+        if (entries_[i].pid == 0) {
+            entries_[i] = {pid, ticks, scan_ns};
+            ++size_;
+            return;
+        }
+    }
+}
+
+bool PidTicksMap::Get(int32_t pid, uint64_t* ticks, int64_t* scan_ns) const {
+    if (entries_.empty()) {
+        return false;
+    }
+    size_t mask = entries_.size() - 1;
+    for (size_t i = Hash(pid) & mask; entries_[i].pid != 0; i = (i + 1) & mask) {
+        if (entries_[i].pid == pid) {
+            *ticks = entries_[i].ticks;
+            *scan_ns = entries_[i].scan_ns;
+            return true;
+        }
+    }
+    return false;
+}
+
+void PidTicksMap::MergeMissing(const PidTicksMap& other) {
+    uint64_t ticks;
+    int64_t scan_ns;
+    for (const Entry& entry : other.entries_) {
+        if (entry.pid != 0 && !Get(entry.pid, &ticks, &scan_ns)) {
+            Put(entry.pid, entry.ticks, entry.scan_ns);
+        }
+    }
+}
+
+ProcessScanner::ProcessScanner(const std::string& proc_root)
+    : proc_root_(proc_root), page_size_(sysconf(_SC_PAGESIZE)), clock_ticks_(sysconf(_SC_CLK_TCK)),
+      dirents_(DIRENTS_BUFFER) {}
+
+ProcessScanner::~ProcessScanner() {
+    if (dir_fd_ >= 0) {
+        close(dir_fd_);
+    }
+}
+
+bool ProcessScanner::Open() {
+    dir_fd_ = open(proc_root_.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    return dir_fd_ >= 0;
+}
+
+bool ProcessScanner::ReadProcess(int32_t pid, int64_t now_ns, ProcessSample* out, uint64_t* ticks) {
+    // "<pid>/stat", 相对于/proc的dirfd打开
+    char path[32];
+    int len = 0;
+    char digits[12];
+    int ndigits = 0;
+    for (int32_t value = pid; value > 0; value /= 10) {
+        digits[ndigits++] = static_cast<char>('0' + value % 10);
+    }
+    while (ndigits > 0) {
+        path[len++] = digits[--ndigits];
+    }
+    memcpy(path + len, "/stat", sizeof("/stat"));
+
+    int fd = openat(dir_fd_, path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false; // 进程刚好退出了
+    }
+    ssize_t n = read(fd, stat_buf_, sizeof(stat_buf_));
+    close(fd);
+    if (n <= 0) {
+        return false;
+    }
+    const char* end = stat_buf_ + n;
+    // pid (comm) state ..., comm里可能有空格和括号, 以最后一个')'为准
+    const char* open_paren = static_cast<const char*>(memchr(stat_buf_, '(', n));
+    const char* close_paren = end;
+    while (close_paren > stat_buf_ && *(close_paren - 1) != ')') {
+        --close_paren;
+    }
+    if (open_paren == nullptr || close_paren <= open_paren + 1) {
+        return false;
+    }
+    size_t name_len = std::min<size_t>(close_paren - 1 - (open_paren + 1), sizeof(out->name) - 1);
+    memcpy(out->name, open_paren + 1, name_len);
+    out->name[name_len] = '\0';
+
+    // ')'之后从第3个字段state开始, utime/stime是第14/15个, rss(页数)是第24个
+    const char* ptr = close_paren;
+    const char* word;
+    size_t word_len;
+    procfs::ParseWord(ptr, end, &word, &word_len); // state
+    uint64_t fields[21] = {0};
+    for (int i = 0; i < 21; ++i) {
+        // 第4到第24个字段都是整数, 有的可能是负数(比如tty_pgrp为-1), 按空白跳过
+        if (!procfs::ParseWord(ptr, end, &word, &word_len)) {
+            return false;
+        }
+        const char* digit = word;
+        if (*digit == '-') {
+            continue;
+        }
+        procfs::ParseU64(digit, word + word_len, &fields[i]);
+    }
+    *ticks = fields[10] + fields[11];
+    out->pid = pid;
+    out->rss_bytes = fields[20] * static_cast<uint64_t>(page_size_);
+    // 上一次的计数可能是更早几轮扫到后一直带下来的, 按它自己的扫描时间算间隔, 不能用上一轮的
+    uint64_t prev;
+    int64_t prev_ns;
+    out->cpu_usage = 0;
+    if (prev_ticks_.Get(pid, &prev, &prev_ns) && prev_ns < now_ns && *ticks >= prev) {
+        double elapsed_ticks = (now_ns - prev_ns) / 1e9 * clock_ticks_;
+        out->cpu_usage = static_cast<float>(100.0 * (*ticks - prev) / elapsed_ticks);
+    }
+    return true;
+}
+
+bool ProcessScanner::Scan(size_t top_n, std::chrono::milliseconds budget,
+                          std::vector<ProcessSample>* top_cpu, std::vector<ProcessSample>* top_rss) {
+    top_cpu->clear();
+    top_rss->clear();
+    if (dir_fd_ < 0) {
+        return true;
+    }
+    int64_t start = MonotonicNs();
+    int64_t deadline = start + std::chrono::duration_cast<std::chrono::nanoseconds>(budget).count();
+
+    samples_.clear();
+    ticks_.Clear();
+    bool complete = true;
+    size_t scanned = 0;
+    // 上一次超时的话从停下的位置接着读; 读到末尾后绕回开头, 扫到这个位置为止.
+    // d_off在同一个目录里按读的顺序递增(/proc下就是pid加上固定偏移)
+    int64_t stop_offset = resume_offset_;
+    bool wrapped = stop_offset == 0;
+    int64_t last_offset = stop_offset;
+    lseek(dir_fd_, stop_offset, SEEK_SET);
+    while (complete) {
+        long n = syscall(SYS_getdents64, dir_fd_, dirents_.data(), dirents_.size());
+        if (n <= 0) {
+            if (n < 0 || wrapped) {
+                break;
+            }
+            wrapped = true;
+            lseek(dir_fd_, 0, SEEK_SET);
+            continue;
+        }
+        for (long offset = 0; offset < n;) {
+            const LinuxDirent64* entry = reinterpret_cast<const LinuxDirent64*>(dirents_.data() + offset);
+            offset += entry->d_reclen;
+            if (wrapped && stop_offset != 0 && entry->d_off > stop_offset) {
+                n = 0; // 绕回来已经扫到上一次开始的位置
+                break;
+            }
+            last_offset = entry->d_off;
+            int32_t pid;
+            if ((entry->d_type != DT_DIR && entry->d_type != DT_UNKNOWN) || !ParsePid(entry->d_name, &pid)) {
+                continue;
+            }
+            ProcessSample sample;
+            uint64_t ticks;
+            if (ReadProcess(pid, start, &sample, &ticks)) {
+                samples_.push_back(sample);
+                ticks_.Put(pid, ticks, start);
+            }
+            if (++scanned % BUDGET_CHECK_EVERY == 0 && MonotonicNs() > deadline) {
+                complete = false;
+                break;
+            }
+        }
+        if (n == 0) {
+            break;
+        }
+    }
+    if (!complete) {
+        // 没扫到的进程留着上一次的计数和扫描时间, 下一次扫到时还能算出使用率
+        ticks_.MergeMissing(prev_ticks_);
+        resume_offset_ = last_offset;
+    } else {
+        resume_offset_ = 0;
+    }
+    std::swap(prev_ticks_, ticks_);
+
+    size_t n = std::min(top_n, samples_.size());
+    auto by_cpu = [](const ProcessSample& a, const ProcessSample& b) { return a.cpu_usage > b.cpu_usage; };
+    auto by_rss = [](const ProcessSample& a, const ProcessSample& b) { return a.rss_bytes > b.rss_bytes; };
+    std::partial_sort(samples_.begin(), samples_.begin() + n, samples_.end(), by_cpu);
+    top_cpu->assign(samples_.begin(), samples_.begin() + n);
+    std::partial_sort(samples_.begin(), samples_.begin() + n, samples_.end(), by_rss);
+    top_rss->assign(samples_.begin(), samples_.begin() + n);
+    return complete;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 一个进程一次扫描的结果
+struct ProcessSample {
+    int32_t pid;
+    char name[16]; // comm最长15个字符
+    float cpu_usage; // 相对一个核的百分比
+    uint64_t rss_bytes;
+};
+
+// 进程ID到上一次累计CPU时间(和读到它的那次扫描的时间)的开放寻址哈希表, 线性探测, 只增不删;
+// 每次扫描往一张空表里插, 扫完和上一张交换, 消失的进程自然被丢掉, 表的内存一直复用.
+class PidTicksMap {
+public:
+    void Clear();
+    void Put(int32_t pid, uint64_t ticks, int64_t scan_ns);
+    // 找不到返回false
+    bool Get(int32_t pid, uint64_t* ticks, int64_t* scan_ns) const;
+    size_t size() const { return size_; }
+    // 把other里有而这里没有的都插进来, 保留它们原来的扫描时间, 不算作这一轮采到的
+    void MergeMissing(const PidTicksMap& other);
+
+private:
+    struct Entry {
+        int32_t pid; // 0表示空位, 进程号不会是0
+        uint64_t ticks;
+        int64_t scan_ns;
+    };
+    void Grow();
+
+    std::vector<Entry> entries_;
+    size_t size_ = 0;
+};
+
+// 扫描/proc下的所有进程, 取CPU和RSS各自最高的N个.
+// 目录用一直开着的dirfd加getdents64读, 每个进程的stat用openat相对dirfd打开, 不拼完整路径.
+// 单次扫描有时间预算, 进程很多的主机上超时就停, 返回已经扫到的部分, 没扫到的进程保留上一次的计数.
+// 超时时记下目录读到的位置, 下一次从那里接着扫, 读到末尾再绕回开头扫到这个位置为止, 大pid的进程也轮得到.
+class ProcessScanner {
+public:
+    explicit ProcessScanner(const std::string& proc_root = "/proc");
+    ~ProcessScanner();
+    ProcessScanner(const ProcessScanner&) = delete;
+    ProcessScanner& operator=(const ProcessScanner&) = delete;
+
+    bool Open();
+    // 结果按从高到低排好; 第一次扫到的进程没有上一次的计数, CPU是0. 超时返回false
+    bool Scan(size_t top_n, std::chrono::milliseconds budget,
+              std::vector<ProcessSample>* top_cpu, std::vector<ProcessSample>* top_rss);
+
+private:
+    bool ReadProcess(int32_t pid, int64_t now_ns, ProcessSample* out, uint64_t* ticks);
+
+    const std::string proc_root_;
+    int dir_fd_ = -1;
+    long page_size_;
+    long clock_ticks_;
+    std::vector<char> dirents_; // getdents64的缓冲区
+    char stat_buf_[1024];
+    PidTicksMap prev_ticks_, ticks_;
+    std::vector<ProcessSample> samples_;
+    int64_t resume_offset_ = 0; // 上一次超时时目录读到的位置(getdents64的d_off), 0表示从头扫
+};
@@ -0,0 +1,381 @@
+#include "procfs_sampler.h"
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+int64_t MonotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+const uint64_t SECTOR_BYTES = 512; // diskstats里的扇区固定按512字节算
+
+// 按内核给分区起名的规则判断: 整盘名后面直接跟分区号(sda1), 整盘名以数字结尾时中间加p(nvme0n1p1, md1p1).
+// 只看前缀会把md12, nvme0n10这样的整盘当成md1, nvme0n1的分区
+bool IsPartitionOf(const std::string& disk, const char* name, size_t name_len) {
+    if (disk.empty() || name_len <= disk.size() || memcmp(name, disk.data(), disk.size()) != 0) {
+        return false;
+    }
+    size_t i = disk.size();
+    if (disk.back() >= '0' && disk.back() <= '9' && name[i++] != 'p') {
+        return false;
+    }
+    if (i == name_len) {
+        return false;
+    }
+    for (; i < name_len; ++i) {
+        if (name[i] < '0' || name[i] > '9') {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+ProcFile::~ProcFile() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+bool ProcFile::Open(const std::string& path, size_t initial_size) {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+    fd_ = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    buf_.resize(initial_size);
+    size_ = 0;
+    return fd_ >= 0;
+}
+
+bool ProcFile::Read() {
+    if (fd_ < 0) {
+        return false;
+    }
+    while (true) {
+        // procfs的内容在每次从偏移0读的时候重新生成, 一次pread读完才是一致的快照
+        ssize_t n = pread(fd_, buf_.data(), buf_.size(), 0);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if (static_cast<size_t>(n) < buf_.size()) {
+            size_ = static_cast<size_t>(n);
+            return true;
+        }
+        // 读满了说明可能没读完, 扩大后重读
+        buf_.resize(buf_.size() * 2);
+    }
+}
+
+namespace procfs {
+
+bool ParseU64(const char*& ptr, const char* end, uint64_t* value) {
+    while (ptr < end && (*ptr == ' ' || *ptr == '\t')) {
+        ++ptr;
+    }
+    if (ptr == end || *ptr < '0' || *ptr > '9') {
+        return false;
+    }
+    uint64_t result = 0;
+    while (ptr < end && *ptr >= '0' && *ptr <= '9') {
+        result = result * 10 + static_cast<uint64_t>(*ptr - '0');
+        ++ptr;
+    }
+    *value = result;
+    return true;
+}
+
+bool ParseFloat(const char*& ptr, const char* end, float* value) {
+    uint64_t integer;
+    if (!ParseU64(ptr, end, &integer)) {
+        return false;
+    }
+    double result = static_cast<double>(integer);
+    if (ptr < end && *ptr == '.') {
+        ++ptr;
+        double scale = 0.1;
+        while (ptr < end && *ptr >= '0' && *ptr <= '9') {
+            result += (*ptr - '0') * scale;
+            scale *= 0.1;
+            ++ptr;
+        }
+    }
+    *value = static_cast<float>(result);
+    return true;
+}
+
+bool ParseWord(const char*& ptr, const char* end, const char** word, size_t* len) {
+    while (ptr < end && (*ptr == ' ' || *ptr == '\t')) {
+        ++ptr;
+    }
+    const char* start = ptr;
+    while (ptr < end && *ptr != ' ' && *ptr != '\t' && *ptr != '\n' && *ptr != ':') {
+        ++ptr;
+    }
+    *word = start;
+    *len = ptr - start;
+    return *len > 0;
+}
+
+void SkipLine(const char*& ptr, const char* end) {
+    const void* newline = memchr(ptr, '\n', end - ptr);
+    ptr = newline != nullptr ? static_cast<const char*>(newline) + 1 : end;
+}
+
+bool StartsWith(const char*& ptr, const char* end, const char* key, size_t key_len) {
+    if (static_cast<size_t>(end - ptr) < key_len || memcmp(ptr, key, key_len) != 0) {
+        return false;
+    }
+    ptr += key_len;
+    return true;
+}
+
+} // namespace procfs
+
+ProcfsSampler::ProcfsSampler(const std::string& proc_root) : proc_root_(proc_root) {}
+
+bool ProcfsSampler::Open() {
+    bool ok = stat_.Open(proc_root_ + "/stat");
+    ok = meminfo_.Open(proc_root_ + "/meminfo") && ok;
+    // 扩展指标的文件打不开只是少报对应的指标
+    loadavg_.Open(proc_root_ + "/loadavg", 256);
+    diskstats_.Open(proc_root_ + "/diskstats", 16384);
+    net_dev_.Open(proc_root_ + "/net/dev", 8192);
+    return ok;
+}
+
+ProcfsSampler::CpuTimes ProcfsSampler::ParseCpuTimes(const char*& ptr, const char* end) {
+    // user nice system idle iowait irq softirq steal, 之后的guest已经算在user里
+    uint64_t fields[8] = {0};
+    for (auto& field : fields) {
+        if (!procfs::ParseU64(ptr, end, &field)) {
+            break;
+        }
+    }
+    CpuTimes times;
+    for (uint64_t field : fields) {
+        times.total += field;
+    }
+    times.idle = fields[3] + fields[4];
+    return times;
+}
+
+float ProcfsSampler::Usage(const CpuTimes& prev, const CpuTimes& cur) {
+    if (prev.total == 0 || cur.total <= prev.total) {
+        return 0.0;
+    }
+    uint64_t total_diff = cur.total - prev.total;
+    uint64_t idle_diff = cur.idle - prev.idle;
+    return 100.0 * (total_diff - idle_diff) / total_diff;
+}
+
+float ProcfsSampler::CpuUsage() {
+    if (!stat_.Read()) {
+        return 0.0;
+    }
+    const char* ptr = stat_.data();
+    const char* end = ptr + stat_.size();
+    // 第一行: cpu user nice system idle iowait irq softirq steal ...
+    static const char CPU_KEY[] = "cpu ";
+    if (!procfs::StartsWith(ptr, end, CPU_KEY, sizeof(CPU_KEY) - 1)) {
+        return 0.0;
+    }
+    CpuTimes cpu = ParseCpuTimes(ptr, end);
+    float usage = Usage(prev_cpu_, cpu);
+    prev_cpu_ = cpu;
+    procfs::SkipLine(ptr, end);
+
+    // 接着是每个核一行: cpu0 ..., cpu1 ...
+    static const char CORE_KEY[] = "cpu";
+    size_t core = 0;
+    while (procfs::StartsWith(ptr, end, CORE_KEY, sizeof(CORE_KEY) - 1)) {
+        uint64_t index;
+        if (procfs::ParseU64(ptr, end, &index)) {
+            CpuTimes times = ParseCpuTimes(ptr, end);
+            if (core >= prev_cores_.size()) {
+                prev_cores_.resize(core + 1);
+                core_usage_.resize(core + 1);
+            }
+            core_usage_[core] = Usage(prev_cores_[core], times);
+            prev_cores_[core] = times;
+            ++core;
+        }
+        procfs::SkipLine(ptr, end);
+    }
+    // 核数变少(CPU下线)时截掉多出来的
+    prev_cores_.resize(core);
+    core_usage_.resize(core);
+    return usage;
+}
+
+float ProcfsSampler::MemoryUsage() {
+    if (!meminfo_.Read()) {
+        return 0.0;
+    }
+    const char* ptr = meminfo_.data();
+    const char* end = ptr + meminfo_.size();
+    static const char TOTAL_KEY[] = "MemTotal:";
+    static const char AVAILABLE_KEY[] = "MemAvailable:";
+    uint64_t mem_total = 0, mem_available = 0;
+    bool found_available = false;
+    // MemTotal在第一行, MemAvailable在第三行, 找到就停
+    while (ptr < end && !found_available) {
+        if (procfs::StartsWith(ptr, end, TOTAL_KEY, sizeof(TOTAL_KEY) - 1)) {
+            procfs::ParseU64(ptr, end, &mem_total);
+        } else if (procfs::StartsWith(ptr, end, AVAILABLE_KEY, sizeof(AVAILABLE_KEY) - 1)) {
+            found_available = procfs::ParseU64(ptr, end, &mem_available);
+        }
+        procfs::SkipLine(ptr, end);
+    }
+
+    if (mem_total > 0) {
+        return 100.0 * (mem_total - mem_available) / mem_total;
+    }
+    return 0.0;
+}
+
+void ProcfsSampler::CollectExtended(ExtendedSample* out) {
+    out->core_usage.assign(core_usage_.begin(), core_usage_.end());
+    ReadLoadavg(out);
+
+    int64_t now = MonotonicNs();
+    double seconds = prev_time_ns_ == 0 ? 0.0 : (now - prev_time_ns_) / 1e9;
+    if (!ReadDiskstats(&disks_)) {
+        disks_.clear();
+    }
+    if (!ReadNetDev(&nets_)) {
+        nets_.clear();
+    }
+    ComputeRates(prev_disks_, disks_, seconds, &out->disks);
+    ComputeRates(prev_nets_, nets_, seconds, &out->nets);
+    disks_.swap(prev_disks_);
+    nets_.swap(prev_nets_);
+    prev_time_ns_ = now;
+}
+
+void ProcfsSampler::ReadLoadavg(ExtendedSample* out) {
+    if (!loadavg_.Read()) {
+        return;
+    }
+    // 0.19 0.23 0.15 2/71 17751
+    const char* ptr = loadavg_.data();
+    const char* end = ptr + loadavg_.size();
+    procfs::ParseFloat(ptr, end, &out->load1);
+    procfs::ParseFloat(ptr, end, &out->load5);
+    procfs::ParseFloat(ptr, end, &out->load15);
+}
+
+void ProcfsSampler::SetCounter(std::vector<DeviceCounter>* counters, size_t index,
+                               const char* name, size_t name_len, uint64_t in_bytes, uint64_t out_bytes) {
+    if (index >= counters->size()) {
+        counters->resize(index + 1);
+    }
+    DeviceCounter& counter = (*counters)[index];
+    // 设备列表一般不变, 名字相同就不再赋值
+    if (counter.name.size() != name_len || memcmp(counter.name.data(), name, name_len) != 0) {
+        counter.name.assign(name, name_len);
+    }
+    counter.in_bytes = in_bytes;
+    counter.out_bytes = out_bytes;
+}
+
+bool ProcfsSampler::ReadDiskstats(std::vector<DeviceCounter>* out) {
+    if (!diskstats_.Read()) {
+        return false;
+    }
+    // major minor name reads merged sectors_read ms writes merged sectors_written ...
+    const char* ptr = diskstats_.data();
+    const char* end = ptr + diskstats_.size();
+    size_t count = 0;
+    while (ptr < end) {
+        uint64_t major, minor, fields[7];
+        const char* name;
+        size_t name_len;
+        bool ok = procfs::ParseU64(ptr, end, &major) && procfs::ParseU64(ptr, end, &minor) &&
+                  procfs::ParseWord(ptr, end, &name, &name_len);
+        for (size_t i = 0; ok && i < 7; ++i) {
+            ok = procfs::ParseU64(ptr, end, &fields[i]);
+        }
+        procfs::SkipLine(ptr, end);
+        if (!ok || (name_len >= 4 && memcmp(name, "loop", 4) == 0) ||
+            (name_len >= 3 && memcmp(name, "ram", 3) == 0)) {
+            continue;
+        }
+        // 分区紧跟在整盘后面(sda, sda1, sda2), 只报整盘, 避免重复计数
+        if (count > 0 && IsPartitionOf((*out)[count - 1].name, name, name_len)) {
+            continue;
+        }
+        SetCounter(out, count++, name, name_len, fields[2] * SECTOR_BYTES, fields[6] * SECTOR_BYTES);
+    }
+    out->resize(count);
+    return true;
+}
+
+bool ProcfsSampler::ReadNetDev(std::vector<DeviceCounter>* out) {
+    if (!net_dev_.Read()) {
+        return false;
+    }
+    // 前两行是表头, 之后每行: "  eth0: rx_bytes rx_packets ... (8个接收字段) tx_bytes ..."
+    const char* ptr = net_dev_.data();
+    const char* end = ptr + net_dev_.size();
+    procfs::SkipLine(ptr, end);
+    procfs::SkipLine(ptr, end);
+    size_t count = 0;
+    while (ptr < end) {
+        const char* name;
+        size_t name_len;
+        uint64_t fields[9];
+        bool ok = procfs::ParseWord(ptr, end, &name, &name_len) && ptr < end && *ptr++ == ':';
+        for (size_t i = 0; ok && i < 9; ++i) {
+            ok = procfs::ParseU64(ptr, end, &fields[i]);
+        }
+        procfs::SkipLine(ptr, end);
+        if (!ok || (name_len == 2 && memcmp(name, "lo", 2) == 0)) {
+            continue;
+        }
+        SetCounter(out, count++, name, name_len, fields[0], fields[8]);
+    }
+    out->resize(count);
+    return true;
+}
+
+void ProcfsSampler::ComputeRates(const std::vector<DeviceCounter>& prev, const std::vector<DeviceCounter>& cur,
+                                 double seconds, std::vector<DeviceRate>* out) {
+    out->resize(cur.size());
+    for (size_t i = 0; i < cur.size(); ++i) {
+        DeviceRate& rate = (*out)[i];
+        if (rate.name != cur[i].name) {
+            rate.name = cur[i].name;
+        }
+        rate.in_bps = 0;
+        rate.out_bps = 0;
+        // 设备顺序一般不变, 先看同一位置, 对不上再按名字找
+        const DeviceCounter* old = nullptr;
+        if (i < prev.size() && prev[i].name == cur[i].name) {
+            old = &prev[i];
+        } else {
+            for (const auto& counter : prev) {
+                if (counter.name == cur[i].name) {
+                    old = &counter;
+                    break;
+                }
+            }
+        }
+        // 计数器回绕或设备重建时这一次报0
+        if (old != nullptr && seconds > 0 &&
+            cur[i].in_bytes >= old->in_bytes && cur[i].out_bytes >= old->out_bytes) {
+            rate.in_bps = static_cast<float>((cur[i].in_bytes - old->in_bytes) / seconds);
+            rate.out_bps = static_cast<float>((cur[i].out_bytes - old->out_bytes) / seconds);
+        }
+    }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// 常开的/proc文件: 打开一次, 之后每次用pread从头重读到同一块缓冲区, 不再有open/close和堆分配.
+// 缓冲区装不下时翻倍重读, 只会发生在刚开始的几次.
+class ProcFile {
+public:
+    ProcFile() = default;
+    ~ProcFile();
+    ProcFile(const ProcFile&) = delete;
+    ProcFile& operator=(const ProcFile&) = delete;
+
+    bool Open(const std::string& path, size_t initial_size = 4096);
+    // 重读整个文件, 失败返回false
+    bool Read();
+
+    const char* data() const { return buf_.data(); }
+    size_t size() const { return size_; }
+    bool is_open() const { return fd_ >= 0; }
+
+private:
+    int fd_ = -1;
+    std::vector<char> buf_;
+    size_t size_ = 0;
+};
+
+// 手写的procfs解析, 只在调用方给的[ptr, end)上移动指针, 不分配内存
+namespace procfs {
+
+// 跳过空格后解析一个十进制无符号整数, 没有数字返回false
+bool ParseU64(const char*& ptr, const char* end, uint64_t* value);
+// 解析"0.52"这样的非负小数
+bool ParseFloat(const char*& ptr, const char* end, float* value);
+// 跳过空白后取一个以空白或':'结尾的词, 指向原缓冲区
+bool ParseWord(const char*& ptr, const char* end, const char** word, size_t* len);
+// 移动到下一行行首
+void SkipLine(const char*& ptr, const char* end);
+// 当前行以key开头时跳过key并返回true
+bool StartsWith(const char*& ptr, const char* end, const char* key, size_t key_len);
+
+} // namespace procfs
+
+// 一个块设备或网卡的速率(字节/秒): 磁盘是读/写, 网卡是收/发
+struct DeviceRate {
+    std::string name;
+    float in_bps;
+    float out_bps;
+};
+
+// 除CPU和内存之外的扩展指标, 每次采集复用同一个对象, 稳定之后不再分配内存
+struct ExtendedSample {
+    std::vector<float> core_usage; // 按cpu0, cpu1...的顺序
+    float load1 = 0;
+    float load5 = 0;
+    float load15 = 0;
+    std::vector<DeviceRate> disks;
+    std::vector<DeviceRate> nets;
+};
+
+// 采集CPU和内存使用率, 以及每个核的使用率, loadavg, 磁盘和网卡速率.
+// proc_root默认是/proc, 可以指向一个按/proc目录结构放好文件的目录, 用来离线重放采样.
+class ProcfsSampler {
+public:
+    explicit ProcfsSampler(const std::string& proc_root = "/proc");
+
+    // 打开需要的文件, 任何一个打不开都返回false
+    bool Open();
+    // 两次调用之间的CPU使用率(百分比), 第一次调用返回0
+    float CpuUsage();
+    // (MemTotal - MemAvailable) / MemTotal
+    float MemoryUsage();
+    // 每个核的使用率取自最近一次CpuUsage, 其余的在这里读; 速率是和上一次调用之间的平均值
+    void CollectExtended(ExtendedSample* out);
+
+private:
+    // 一个设备的累计计数
+    struct DeviceCounter {
+        std::string name;
+        uint64_t in_bytes;
+        uint64_t out_bytes;
+    };
+    struct CpuTimes {
+        uint64_t total = 0;
+        uint64_t idle = 0;
+    };
+
+    // 一行cpu字段的总时间和空闲时间
+    static CpuTimes ParseCpuTimes(const char*& ptr, const char* end);
+    static float Usage(const CpuTimes& prev, const CpuTimes& cur);
+    void ReadLoadavg(ExtendedSample* out);
+    // 读出这一次的设备累计字节数
+    bool ReadDiskstats(std::vector<DeviceCounter>* out);
+    bool ReadNetDev(std::vector<DeviceCounter>* out);
+    static void ComputeRates(const std::vector<DeviceCounter>& prev, const std::vector<DeviceCounter>& cur,
+                             double seconds, std::vector<DeviceRate>* out);
+    static void SetCounter(std::vector<DeviceCounter>* counters, size_t index,
+                           const char* name, size_t name_len, uint64_t in_bytes, uint64_t out_bytes);
+
+    const std::string proc_root_;
+    ProcFile stat_;
+    ProcFile meminfo_;
+    ProcFile loadavg_;
+    ProcFile diskstats_;
+    ProcFile net_dev_;
+    CpuTimes prev_cpu_;
+    std::vector<CpuTimes> prev_cores_;
+    std::vector<float> core_usage_;
+
+    // 本次和上次的设备计数, 每次采集后交换, 名字的内存一直复用
+    std::vector<DeviceCounter> disks_, prev_disks_;
+    std::vector<DeviceCounter> nets_, prev_nets_;
+    int64_t prev_time_ns_ = 0;
+};
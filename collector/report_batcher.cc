@@ -0,0 +1,41 @@
+#include "report_batcher.h"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+
+int32_t Quantize(float usage) {
+    return static_cast<int32_t>(std::lround(usage * 100.0f));
+}
+
+} // namespace
+
+bool ReportBatcher::Add(int64_t timestamp, float cpu_usage, float memory_usage) {
+    int32_t cpu = Quantize(cpu_usage);
+    int32_t memory = Quantize(memory_usage);
+    if (deadband_ > 0 && has_reported_ && std::abs(cpu - reported_cpu_) <= deadband_ &&
+        std::abs(memory - reported_memory_) <= deadband_) {
+        return false;
+    }
+    has_reported_ = true;
+    reported_cpu_ = cpu;
+    reported_memory_ = memory;
+    // 相邻两点的时间差和数值差都很小, sint的zigzag编码后大多只占1~2个字节
+    batch_.add_timestamp_deltas(timestamp - last_timestamp_);
+    batch_.add_cpu_deltas(cpu - last_cpu_);
+    batch_.add_memory_deltas(memory - last_memory_);
+    last_timestamp_ = timestamp;
+    last_cpu_ = cpu;
+    last_memory_ = memory;
+    return true;
+}
+
+void ReportBatcher::Take(dmonitor::ReportBatchRequest* request) {
+    request->Clear();
+    request->Swap(&batch_);
+    // 每一批的差分都从0开始, 批和批之间互不依赖, 丢一批不影响后面的解码
+    last_timestamp_ = 0;
+    last_cpu_ = 0;
+    last_memory_ = 0;
+}
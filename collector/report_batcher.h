@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "monitor.pb.h"
+
+// 把高频采样攒成一个ReportBatchRequest: 时间戳和使用率(×100取整)都和前一个点做差分,
+// 直接追加到请求的packed字段里, 攒的过程中不再有别的中间容器.
+// deadband大于0时是死区模式: CPU和内存相对上一个上报的点都没变超过deadband(百分点)的采样不攒.
+class ReportBatcher {
+public:
+    explicit ReportBatcher(float deadband = 0) : deadband_(static_cast<int32_t>(std::lround(deadband * 100))) {}
+
+    // 返回这个点是否攒进了批次
+    bool Add(int64_t timestamp, float cpu_usage, float memory_usage);
+    // 下一个点不管变没变都攒, center重启后先给它一个基准值
+    void ForceNext() { has_reported_ = false; }
+    size_t size() const { return batch_.timestamp_deltas_size(); }
+    bool empty() const { return size() == 0; }
+    // 最后一个攒进来的点的时间, 空批次是0
+    int64_t last_timestamp() const { return last_timestamp_; }
+    // 取走攒好的数据(只有采样字段), 之后从空批次重新开始
+    void Take(dmonitor::ReportBatchRequest* request);
+
+private:
+    dmonitor::ReportBatchRequest batch_;
+    int64_t last_timestamp_ = 0;
+    int32_t last_cpu_ = 0;
+    int32_t last_memory_ = 0;
+    // 死区比较的基准是上一个攒进来的点, 跨批次保留
+    const int32_t deadband_;
+    bool has_reported_ = false;
+    int32_t reported_cpu_ = 0;
+    int32_t reported_memory_ = 0;
+};
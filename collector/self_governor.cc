@@ -0,0 +1,70 @@
+#include "self_governor.h"
+
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <unistd.h>
+
+namespace {
+
+int64_t MonotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+} // namespace
+
+SelfGovernor::SelfGovernor(float cpu_budget, uint64_t rss_budget_bytes)
+    : cpu_budget_(cpu_budget), rss_budget_(rss_budget_bytes),
+      page_size_(sysconf(_SC_PAGESIZE)), clock_ticks_(sysconf(_SC_CLK_TCK)) {
+    stat_.Open("/proc/self/stat", 1024);
+}
+
+void SelfGovernor::Update() {
+    if (!stat_.Read()) {
+        return;
+    }
+    // 自己的comm不会有')', 第一个')'之后从state开始; utime/stime是第14/15个字段, rss是第24个
+    const char* ptr = static_cast<const char*>(memchr(stat_.data(), ')', stat_.size()));
+    if (ptr == nullptr) {
+        return;
+    }
+    const char* end = stat_.data() + stat_.size();
+    ++ptr;
+    const char* word;
+    size_t len;
+    uint64_t fields[22] = {0};
+    for (uint64_t& field : fields) {
+        if (!procfs::ParseWord(ptr, end, &word, &len)) {
+            return;
+        }
+        procfs::ParseU64(word, word + len, &field); // state和负数字段解析失败, 留0
+    }
+    // fields[0]是state, fields[i]是第i+3个字段
+    uint64_t ticks = fields[11] + fields[12];
+    rss_bytes_ = fields[21] * static_cast<uint64_t>(page_size_);
+    int64_t now = MonotonicNs();
+    if (prev_ns_ != 0 && now > prev_ns_ && ticks >= prev_ticks_) {
+        cpu_usage_ = static_cast<float>(100.0 * (ticks - prev_ticks_) / clock_ticks_ / ((now - prev_ns_) / 1e9));
+    }
+    prev_ticks_ = ticks;
+    prev_ns_ = now;
+
+    bool over = (cpu_budget_ > 0 && cpu_usage_ > cpu_budget_) || (rss_budget_ > 0 && rss_bytes_ > rss_budget_);
+    bool calm = (cpu_budget_ <= 0 || cpu_usage_ < cpu_budget_ / 2) && (rss_budget_ == 0 || rss_bytes_ < rss_budget_ / 2);
+    int old_level = level_;
+    if (over) {
+        calm_periods_ = 0;
+        if (level_ < MAX_LEVEL) {
+            ++level_;
+        }
+    } else if (calm && level_ > 0 && ++calm_periods_ >= RECOVER_PERIODS) {
+        calm_periods_ = 0;
+        --level_;
+    }
+    if (level_ != old_level) {
+        std::cerr << "Collector overhead CPU=" << cpu_usage_ << "% RSS=" << (rss_bytes_ >> 20)
+                  << "MB, throttle level " << old_level << " -> " << level_ << std::endl;
+    }
+}
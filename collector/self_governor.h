@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+#include "procfs_sampler.h"
+
+// collector自身开销的调节器: 每个上报周期从/proc/self/stat读自己的CPU和RSS,
+// 超过预算就逐级降级, 连续几个周期都远低于预算再逐级恢复.
+//   1级: 不扫进程
+//   2级: 也不采cgroup
+//   3级: 每2个节拍才采一次样
+//   4级: 每4个节拍才采一次样
+class SelfGovernor {
+public:
+    static constexpr int MAX_LEVEL = 4;
+
+    // cpu_budget是相对一个核的百分比, 不大于0表示不限制
+    SelfGovernor(float cpu_budget, uint64_t rss_budget_bytes);
+
+    // 读一次自己的开销并调整级别, 每个上报周期调用一次
+    void Update();
+
+    float cpu_usage() const { return cpu_usage_; }
+    uint64_t rss_bytes() const { return rss_bytes_; }
+    int level() const { return level_; }
+    bool scan_processes() const { return level_ < 1; }
+    bool collect_cgroups() const { return level_ < 2; }
+    // 每几个节拍采一次样
+    uint64_t sample_stride() const { return level_ < 3 ? 1 : uint64_t(1) << (level_ - 2); }
+
+private:
+    // 低于预算的一半连续这么多个周期才降一级, 避免在边界上来回抖
+    static constexpr int RECOVER_PERIODS = 3;
+
+    const float cpu_budget_;
+    const uint64_t rss_budget_;
+    ProcFile stat_;
+    long page_size_;
+    long clock_ticks_;
+    uint64_t prev_ticks_ = 0;
+    int64_t prev_ns_ = 0;
+    float cpu_usage_ = 0;
+    uint64_t rss_bytes_ = 0;
+    int level_ = 0;
+    int calm_periods_ = 0;
+};
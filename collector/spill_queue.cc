@@ -0,0 +1,165 @@
+#include "spill_queue.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+const char SPILL_MAGIC[8] = {'D', 'M', 'S', 'P', 'I', 'L', 'L', '1'};
+
+} // namespace
+
+// head和tail是一直增长的逻辑偏移, 对capacity取模才是数据区里的位置, tail - head是已用字节数
+struct SpillQueue::Header {
+    char magic[8];
+    uint64_t capacity;
+    uint64_t head;
+    uint64_t tail;
+    uint64_t count;
+};
+
+SpillQueue::~SpillQueue() {
+    if (map_ != nullptr) {
+        munmap(map_, map_size_);
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+bool SpillQueue::Open(const std::string& path, size_t capacity) {
+    fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        std::cerr << "Cannot open spill file " << path << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+    map_size_ = sizeof(Header) + capacity;
+    struct stat st;
+    bool fresh = fstat(fd_, &st) != 0 || static_cast<size_t>(st.st_size) != map_size_;
+    if (fresh && ftruncate(fd_, map_size_) != 0) {
+        std::cerr << "Cannot resize spill file " << path << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+    void* map = mmap(nullptr, map_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (map == MAP_FAILED) {
+        std::cerr << "Cannot mmap spill file " << path << ": " << strerror(errno) << std::endl;
+        return false;
+    }
+    map_ = static_cast<char*>(map);
+    header_ = reinterpret_cast<Header*>(map_);
+    data_ = map_ + sizeof(Header);
+    capacity_ = capacity;
+
+    if (fresh || memcmp(header_->magic, SPILL_MAGIC, sizeof(SPILL_MAGIC)) != 0 ||
+        header_->capacity != capacity_ || header_->tail < header_->head ||
+        header_->tail - header_->head > capacity_) {
+        memcpy(header_->magic, SPILL_MAGIC, sizeof(SPILL_MAGIC));
+        header_->capacity = capacity_;
+        header_->head = 0;
+        header_->tail = 0;
+        header_->count = 0;
+    } else if (header_->count > 0) {
+        std::cout << "Spill file " << path << " has " << header_->count << " pending batches" << std::endl;
+    }
+    return true;
+}
+
+void SpillQueue::Read(uint64_t offset, void* out, size_t len) const {
+    size_t pos = offset % capacity_;
+    size_t first = std::min<size_t>(len, capacity_ - pos);
+    memcpy(out, data_ + pos, first);
+    memcpy(static_cast<char*>(out) + first, data_, len - first);
+}
+
+void SpillQueue::Write(uint64_t offset, const void* data, size_t len) {
+    size_t pos = offset % capacity_;
+    size_t first = std::min<size_t>(len, capacity_ - pos);
+    memcpy(data_ + pos, data, first);
+    memcpy(data_, static_cast<const char*>(data) + first, len - first);
+}
+
+bool SpillQueue::HeadRecordSize(uint32_t* len) const {
+    uint64_t used = header_->tail - header_->head;
+    if (used < sizeof(*len)) {
+        return false;
+    }
+    Read(header_->head, len, sizeof(*len));
+    return *len <= capacity_ && sizeof(*len) + *len <= used;
+}
+
+void SpillQueue::Reset(const char* reason) {
+    std::cerr << "Spill file corrupted (" << reason << "), discarding " << header_->count
+              << " pending batches" << std::endl;
+    dropped_ += header_->count;
+    header_->head = 0;
+    header_->tail = 0;
+    header_->count = 0;
+}
+
+bool SpillQueue::Push(const std::string& record) {
+    if (map_ == nullptr) {
+        return false;
+    }
+    uint64_t need = sizeof(uint32_t) + record.size();
+    if (need > capacity_) {
+        return false;
+    }
+    // 放不下就丢最旧的, 保留最近的数据
+    while (capacity_ - (header_->tail - header_->head) < need) {
+        Pop();
+        ++dropped_;
+    }
+    uint32_t len = static_cast<uint32_t>(record.size());
+    Write(header_->tail, &len, sizeof(len));
+    Write(header_->tail + sizeof(len), record.data(), record.size());
+    // 先写数据再推进tail, 进程中途退出时最多丢这一条; 机器掉电要看页缓存有没有刷下去
+    header_->tail += need;
+    ++header_->count;
+    return true;
+}
+
+bool SpillQueue::Front(std::string* record) {
+    if (empty()) {
+        return false;
+    }
+    uint32_t len;
+    if (!HeadRecordSize(&len)) {
+        Reset("bad record length");
+        return false;
+    }
+    record->resize(len);
+    Read(header_->head + sizeof(len), &(*record)[0], len);
+    return true;
+}
+
+void SpillQueue::Pop() {
+    if (empty()) {
+        return;
+    }
+    uint32_t len;
+    if (!HeadRecordSize(&len) || header_->count == 0) {
+        Reset("bad record length");
+        return;
+    }
+    header_->head += sizeof(len) + len;
+    --header_->count;
+    if (header_->head == header_->tail) {
+        // 空了就回到开头, 下一条记录不用绕环
+        header_->head = 0;
+        header_->tail = 0;
+    }
+}
+
+bool SpillQueue::empty() const {
+    return header_ == nullptr || header_->head == header_->tail;
+}
+
+uint64_t SpillQueue::count() const {
+    return header_ == nullptr ? 0 : header_->count;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// center连不上时暂存上报数据的磁盘队列: 一个固定大小的mmap文件, 里面是首尾相接的字节环,
+// 每条记录是u32长度加内容. 写满后丢最旧的记录, 文件不会无限增长.
+// 头部记着读写位置, collector重启后接着上次没发完的数据继续补发.
+class SpillQueue {
+public:
+    SpillQueue() = default;
+    ~SpillQueue();
+    SpillQueue(const SpillQueue&) = delete;
+    SpillQueue& operator=(const SpillQueue&) = delete;
+
+    // 打开或创建文件, capacity是数据区字节数; 文件大小不一致或头部损坏时清空重建
+    bool Open(const std::string& path, size_t capacity);
+    // 追加一条记录, 放不下时先丢掉最旧的; 单条比整个数据区还大返回false
+    bool Push(const std::string& record);
+    // 读最旧的一条, 不移除. 记录长度和读写位置对不上(写到一半断电或者文件被改坏)时清空整个队列并返回false
+    bool Front(std::string* record);
+    void Pop();
+
+    bool empty() const;
+    uint64_t count() const;
+    uint64_t dropped() const { return dropped_; }
+
+private:
+    struct Header;
+
+    void Read(uint64_t offset, void* out, size_t len) const;
+    void Write(uint64_t offset, const void* data, size_t len);
+    // 读head处记录的长度并检查它在已用字节和数据区之内
+    bool HeadRecordSize(uint32_t* len) const;
+    // 队列内容不可信时丢掉所有记录
+    void Reset(const char* reason);
+
+    int fd_ = -1;
+    char* map_ = nullptr;
+    size_t map_size_ = 0;
+    Header* header_ = nullptr;
+    char* data_ = nullptr;
+    uint64_t capacity_ = 0;
+    uint64_t dropped_ = 0;
+};
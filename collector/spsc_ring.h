@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// 单生产者单消费者的无锁环形队列: 采样线程放, 发送线程取.
+// 两边各自只写自己的下标, 用acquire/release配对, 不需要锁也不会互相阻塞.
+// 容量取整到2的幂, 槽位预先构造好, 放进去和取出来都是move, 稳定后不分配内存.
+template <typename T>
+class SpscRing {
+public:
+    explicit SpscRing(size_t capacity) {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        slots_.resize(size);
+        mask_ = size - 1;
+    }
+
+    // 只能在生产者线程调用; 满了返回false, value保持不变
+    bool TryPush(T&& value) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) > mask_) {
+            return false;
+        }
+        slots_[tail & mask_] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 只能在消费者线程调用; 空了返回false
+    bool TryPop(T* value) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        *value = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 生产者看到的不满, 之后只会因为消费者取走而更空
+    bool full() const {
+        return tail_.load(std::memory_order_relaxed) - head_.load(std::memory_order_acquire) > mask_;
+    }
+
+private:
+    std::vector<T> slots_;
+    size_t mask_ = 0;
+    alignas(64) std::atomic<size_t> head_{0}; // 消费者写
+    alignas(64) std::atomic<size_t> tail_{0}; // 生产者写
+};
@@ -0,0 +1,90 @@
+#include "tick_scheduler.h"
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <sys/timerfd.h>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+struct timespec ToTimespec(int64_t ms) {
+    struct timespec ts;
+    ts.tv_sec = ms / 1000;
+    ts.tv_nsec = (ms % 1000) * 1000000;
+    return ts;
+}
+
+} // namespace
+
+TickScheduler::~TickScheduler() {
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+bool TickScheduler::Start(std::chrono::milliseconds period, std::chrono::milliseconds align,
+                          std::chrono::milliseconds phase) {
+    period_ = period;
+    align_ = align.count() > 0 ? align : period;
+    phase_ = phase;
+    fd_ = timerfd_create(CLOCK_REALTIME, TFD_CLOEXEC);
+    if (fd_ < 0) {
+        std::cerr << "timerfd_create failed: " << strerror(errno) << std::endl;
+        return false;
+    }
+    return Arm();
+}
+
+bool TickScheduler::Arm() {
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    int64_t now_ms = static_cast<int64_t>(now.tv_sec) * 1000 + now.tv_nsec / 1000000;
+    int64_t first = (now_ms / align_.count() + 1) * align_.count() + phase_.count();
+
+    struct itimerspec spec;
+    spec.it_value = ToTimespec(first);
+    spec.it_interval = ToTimespec(period_.count());
+    // 系统时间被改时read返回ECANCELED, 由Wait重新对齐
+    if (timerfd_settime(fd_, TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET, &spec, nullptr) != 0) {
+        std::cerr << "timerfd_settime failed: " << strerror(errno) << std::endl;
+        return false;
+    }
+    return true;
+}
+
+uint64_t TickScheduler::Wait() {
+    if (fd_ < 0) {
+        // 没有timerfd就退化成按间隔睡眠
+        std::this_thread::sleep_for(period_);
+        return 1;
+    }
+    while (true) {
+        uint64_t expirations = 0;
+        ssize_t n = read(fd_, &expirations, sizeof(expirations));
+        if (n == sizeof(expirations)) {
+            return expirations;
+        }
+        if (n < 0 && errno == ECANCELED) {
+            Arm();
+            return 1;
+        }
+        if (n < 0 && errno != EINTR) {
+            std::cerr << "timerfd read failed: " << strerror(errno) << std::endl;
+            std::this_thread::sleep_for(period_);
+            return 1;
+        }
+    }
+}
+
+std::chrono::milliseconds TickScheduler::HostPhase(const std::string& hostname, std::chrono::milliseconds interval) {
+    // FNV-1a, 相近的主机名(web-01, web-02)也会散到完全不同的位置
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : hostname) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return interval.count() > 0 ? std::chrono::milliseconds(hash % interval.count()) : interval;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// 按绝对时间触发的周期定时器, 基于CLOCK_REALTIME的timerfd.
+// 第i次触发在 首个align边界 + phase + i * period, 和采样、上报花了多久无关, 不会越走越慢.
+// 用墙上时间是为了让所有主机对齐到同一组边界, 再用各自的phase错开; 系统时间被调整时重新对齐.
+class TickScheduler {
+public:
+    TickScheduler() = default;
+    ~TickScheduler();
+    TickScheduler(const TickScheduler&) = delete;
+    TickScheduler& operator=(const TickScheduler&) = delete;
+
+    bool Start(std::chrono::milliseconds period, std::chrono::milliseconds align, std::chrono::milliseconds phase);
+    // 阻塞到下一次触发, 返回上次返回之后到期的次数, 大于1说明处理太慢错过了触发
+    uint64_t Wait();
+
+    // 由主机名散列出[0, interval)里的相位, 同一台主机每次启动都一样, 不同主机均匀散开
+    static std::chrono::milliseconds HostPhase(const std::string& hostname, std::chrono::milliseconds interval);
+
+private:
+    bool Arm();
+
+    int fd_ = -1;
+    std::chrono::milliseconds period_{0};
+    std::chrono::milliseconds align_{0};
+    std::chrono::milliseconds phase_{0};
+};
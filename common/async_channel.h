@@ -0,0 +1,108 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "backoff_channel.h"
+
+// 可以同时有多个调用在途的RpcChannel: 后台几个工作线程各自持有一个BackoffChannel(各自一条连接),
+// 调用排进队列由空闲的线程发出.
+//   done不为空: CallMethod立即返回, 调用完成后在工作线程里执行done->Run()
+//   done为空:   和KrpcChannel一样阻塞到调用完成, 多个线程同时调用时并行发出
+// krpc的一条连接同一时刻只能有一个调用(发完阻塞在recv上等响应), 所以并行度就是连接数.
+// 没有做一条连接上的流水线: 请求和响应要靠RpcHeader里的call_id对上, RpcHeader和收发逻辑都在
+// 预编译的krpc_core里, 改不了. 同时在途的调用最多connections个, 再多的在队列里排队.
+class AsyncChannel : public google::protobuf::RpcChannel {
+public:
+    explicit AsyncChannel(size_t connections,
+                          std::chrono::milliseconds reconnect_base = std::chrono::milliseconds(500),
+                          std::chrono::milliseconds reconnect_max = std::chrono::milliseconds(30000)) {
+        for (size_t i = 0; i < std::max<size_t>(connections, 1); ++i) {
+            channels_.push_back(std::make_unique<BackoffChannel>(reconnect_base, reconnect_max));
+        }
+        for (size_t i = 0; i < channels_.size(); ++i) {
+            workers_.emplace_back([this, i]() { WorkerThread(*channels_[i]); });
+        }
+    }
+
+    ~AsyncChannel() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cond_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void CallMethod(const google::protobuf::MethodDescriptor* method, google::protobuf::RpcController* controller,
+                    const google::protobuf::Message* request, google::protobuf::Message* response,
+                    google::protobuf::Closure* done) override {
+        if (done != nullptr) {
+            Enqueue({method, controller, request, response, done});
+            return;
+        }
+        // 同步调用: 用一个在栈上的完成标记等工作线程做完
+        SyncDone sync;
+        Enqueue({method, controller, request, response, &sync});
+        std::unique_lock<std::mutex> lock(sync.mutex);
+        sync.cond.wait(lock, [&sync]() { return sync.finished; });
+    }
+
+private:
+    struct Call {
+        const google::protobuf::MethodDescriptor* method;
+        google::protobuf::RpcController* controller;
+        const google::protobuf::Message* request;
+        google::protobuf::Message* response;
+        google::protobuf::Closure* done;
+    };
+
+    struct SyncDone : public google::protobuf::Closure {
+        void Run() override {
+            std::lock_guard<std::mutex> lock(mutex);
+            finished = true;
+            cond.notify_one();
+        }
+        std::mutex mutex;
+        std::condition_variable cond;
+        bool finished = false;
+    };
+
+    void Enqueue(const Call& call) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back(call);
+        }
+        cond_.notify_one();
+    }
+
+    void WorkerThread(BackoffChannel& channel) {
+        while (true) {
+            Call call;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cond_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+                // 退出前把已经排队的调用做完, 不让调用方的done永远等不到
+                if (queue_.empty()) {
+                    return;
+                }
+                call = queue_.front();
+                queue_.pop_front();
+            }
+            channel.CallMethod(call.method, call.controller, call.request, call.response, call.done);
+        }
+    }
+
+    std::vector<std::unique_ptr<BackoffChannel>> channels_;
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    std::deque<Call> queue_;
+    bool stopping_ = false;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "Krpcchannel.h"
+#include "Krpccontroller.h"
+
+// 包在KrpcChannel外面的RpcChannel: 一直复用同一个KrpcChannel(连接和查到的服务地址都留在里面),
+// 只有调用失败时才丢掉它, 下次调用重新建连接、重新去ZooKeeper查地址.
+// 失败后按指数退避加随机抖动等待, 等待期间的调用直接失败, 不拨号也不查ZooKeeper,
+// center重启时成千上万个客户端不会在同一时刻一起重连. 不是线程安全的, 每个线程用自己的.
+class BackoffChannel : public google::protobuf::RpcChannel {
+public:
+    struct Stats {
+        uint64_t calls = 0;      // 所有调用
+        uint64_t dials = 0;      // 新建KrpcChannel的次数, 每次都会重新查服务地址、建连接
+        uint64_t failures = 0;   // 真正发出去但失败的调用
+        uint64_t backed_off = 0; // 退避期间直接失败、没有发出去的调用
+    };
+
+    BackoffChannel(std::chrono::milliseconds base_delay = std::chrono::milliseconds(500),
+                   std::chrono::milliseconds max_delay = std::chrono::milliseconds(30000))
+        : base_delay_(base_delay), max_delay_(max_delay), random_(std::random_device{}()) {}
+
+    void CallMethod(const google::protobuf::MethodDescriptor* method, google::protobuf::RpcController* controller,
+                    const google::protobuf::Message* request, google::protobuf::Message* response,
+                    google::protobuf::Closure* done) override {
+        ++stats_.calls;
+        // 调用方没给controller时用自己的, 否则看不出调用有没有失败
+        Krpccontroller local;
+        google::protobuf::RpcController* ctrl = controller != nullptr ? controller : &local;
+        auto now = std::chrono::steady_clock::now();
+        if (now < retry_at_) {
+            ++stats_.backed_off;
+            ctrl->SetFailed("backing off before reconnect");
+        } else {
+            if (channel_ == nullptr) {
+                channel_ = std::make_unique<KrpcChannel>(false);
+                ++stats_.dials;
+            }
+            channel_->CallMethod(method, ctrl, request, response, nullptr);
+            if (ctrl->Failed()) {
+                ++stats_.failures;
+                // 连接可能已经坏了, 服务也可能换了地址, 下次从头来
+                channel_.reset();
+                retry_at_ = now + NextDelay();
+            } else {
+                attempts_ = 0;
+            }
+        }
+        if (done != nullptr) {
+            done->Run();
+        }
+    }
+
+    const Stats& stats() const { return stats_; }
+    bool backing_off() const { return std::chrono::steady_clock::now() < retry_at_; }
+
+private:
+    // 第n次连续失败等 base * 2^n (不超过max), 再在[一半, 全部]之间随机取
+    std::chrono::milliseconds NextDelay() {
+        int64_t delay = base_delay_.count() << std::min(attempts_, 20);
+        delay = std::min<int64_t>(delay, max_delay_.count());
+        ++attempts_;
+        std::uniform_int_distribution<int64_t> jitter(delay / 2, delay);
+        return std::chrono::milliseconds(jitter(random_));
+    }
+
+    const std::chrono::milliseconds base_delay_;
+    const std::chrono::milliseconds max_delay_;
+    std::unique_ptr<KrpcChannel> channel_;
+    std::chrono::steady_clock::time_point retry_at_;
+    int attempts_ = 0;
+    std::mt19937_64 random_;
+    Stats stats_;
+};
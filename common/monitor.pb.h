@@ -1,1886 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: monitor.proto
-
-#ifndef GOOGLE_PROTOBUF_INCLUDED_monitor_2eproto
-#define GOOGLE_PROTOBUF_INCLUDED_monitor_2eproto
-
-#include <limits>
-#include <string>
-
-#include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
-#error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers. Please update
-#error your headers.
-#endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
-#error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers. Please
-#error regenerate this file with a newer version of protoc.
-#endif
-
-#include <google/protobuf/port_undef.inc>
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/arena.h>
-#include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
-#include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata_lite.h>
-#include <google/protobuf/generated_message_reflection.h>
-#include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
-#include <google/protobuf/extension_set.h>  // IWYU pragma: export
-#include <google/protobuf/service.h>
-#include <google/protobuf/unknown_field_set.h>
-// @@protoc_insertion_point(includes)
-#include <google/protobuf/port_def.inc>
-#define PROTOBUF_INTERNAL_EXPORT_monitor_2eproto
-PROTOBUF_NAMESPACE_OPEN
-namespace internal {
-class AnyMetadata;
-}  // namespace internal
-PROTOBUF_NAMESPACE_CLOSE
-
-// Internal implementation detail -- do not use these members.
-struct TableStruct_monitor_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[6]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
-};
-extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_monitor_2eproto;
-namespace dmonitor {
-class MetricsData;
-class MetricsDataDefaultTypeInternal;
-extern MetricsDataDefaultTypeInternal _MetricsData_default_instance_;
-class QueryRequest;
-class QueryRequestDefaultTypeInternal;
-extern QueryRequestDefaultTypeInternal _QueryRequest_default_instance_;
-class QueryResponse;
-class QueryResponseDefaultTypeInternal;
-extern QueryResponseDefaultTypeInternal _QueryResponse_default_instance_;
-class ReportRequest;
-class ReportRequestDefaultTypeInternal;
-extern ReportRequestDefaultTypeInternal _ReportRequest_default_instance_;
-class ReportResponse;
-class ReportResponseDefaultTypeInternal;
-extern ReportResponseDefaultTypeInternal _ReportResponse_default_instance_;
-class ResultCode;
-class ResultCodeDefaultTypeInternal;
-extern ResultCodeDefaultTypeInternal _ResultCode_default_instance_;
-}  // namespace dmonitor
-PROTOBUF_NAMESPACE_OPEN
-template<> ::dmonitor::MetricsData* Arena::CreateMaybeMessage<::dmonitor::MetricsData>(Arena*);
-template<> ::dmonitor::QueryRequest* Arena::CreateMaybeMessage<::dmonitor::QueryRequest>(Arena*);
-template<> ::dmonitor::QueryResponse* Arena::CreateMaybeMessage<::dmonitor::QueryResponse>(Arena*);
-template<> ::dmonitor::ReportRequest* Arena::CreateMaybeMessage<::dmonitor::ReportRequest>(Arena*);
-template<> ::dmonitor::ReportResponse* Arena::CreateMaybeMessage<::dmonitor::ReportResponse>(Arena*);
-template<> ::dmonitor::ResultCode* Arena::CreateMaybeMessage<::dmonitor::ResultCode>(Arena*);
-PROTOBUF_NAMESPACE_CLOSE
-namespace dmonitor {
-
-// ===================================================================
-
-class MetricsData PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dmonitor.MetricsData) */ {
- public:
-  inline MetricsData() : MetricsData(nullptr) {};
-  virtual ~MetricsData();
-
-  MetricsData(const MetricsData& from);
-  MetricsData(MetricsData&& from) noexcept
-    : MetricsData() {
-    *this = ::std::move(from);
-  }
-
-  inline MetricsData& operator=(const MetricsData& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline MetricsData& operator=(MetricsData&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const MetricsData& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const MetricsData* internal_default_instance() {
-    return reinterpret_cast<const MetricsData*>(
-               &_MetricsData_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    0;
-
-  friend void swap(MetricsData& a, MetricsData& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(MetricsData* other) {
-    if (other == this) return;
-    if (GetArena() == other->GetArena()) {
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(MetricsData* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline MetricsData* New() const final {
-    return CreateMaybeMessage<MetricsData>(nullptr);
-  }
-
-  MetricsData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<MetricsData>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const MetricsData& from);
-  void MergeFrom(const MetricsData& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(MetricsData* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "dmonitor.MetricsData";
-  }
-  protected:
-  explicit MetricsData(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_monitor_2eproto);
-    return ::descriptor_table_monitor_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kServerNameFieldNumber = 1,
-    kTimestampFieldNumber = 2,
-    kCpuUsageFieldNumber = 3,
-    kMemoryUsageFieldNumber = 4,
-  };
-  // string server_name = 1;
-  void clear_server_name();
-  const std::string& server_name() const;
-  void set_server_name(const std::string& value);
-  void set_server_name(std::string&& value);
-  void set_server_name(const char* value);
-  void set_server_name(const char* value, size_t size);
-  std::string* mutable_server_name();
-  std::string* release_server_name();
-  void set_allocated_server_name(std::string* server_name);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_server_name();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_server_name(
-      std::string* server_name);
-  private:
-  const std::string& _internal_server_name() const;
-  void _internal_set_server_name(const std::string& value);
-  std::string* _internal_mutable_server_name();
-  public:
-
-  // int64 timestamp = 2;
-  void clear_timestamp();
-  ::PROTOBUF_NAMESPACE_ID::int64 timestamp() const;
-  void set_timestamp(::PROTOBUF_NAMESPACE_ID::int64 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_timestamp() const;
-  void _internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::int64 value);
-  public:
-
-  // float cpu_usage = 3;
-  void clear_cpu_usage();
-  float cpu_usage() const;
-  void set_cpu_usage(float value);
-  private:
-  float _internal_cpu_usage() const;
-  void _internal_set_cpu_usage(float value);
-  public:
-
-  // float memory_usage = 4;
-  void clear_memory_usage();
-  float memory_usage() const;
-  void set_memory_usage(float value);
-  private:
-  float _internal_memory_usage() const;
-  void _internal_set_memory_usage(float value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:dmonitor.MetricsData)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_name_;
-  ::PROTOBUF_NAMESPACE_ID::int64 timestamp_;
-  float cpu_usage_;
-  float memory_usage_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_monitor_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ResultCode PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dmonitor.ResultCode) */ {
- public:
-  inline ResultCode() : ResultCode(nullptr) {};
-  virtual ~ResultCode();
-
-  ResultCode(const ResultCode& from);
-  ResultCode(ResultCode&& from) noexcept
-    : ResultCode() {
-    *this = ::std::move(from);
-  }
-
-  inline ResultCode& operator=(const ResultCode& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ResultCode& operator=(ResultCode&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const ResultCode& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ResultCode* internal_default_instance() {
-    return reinterpret_cast<const ResultCode*>(
-               &_ResultCode_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    1;
-
-  friend void swap(ResultCode& a, ResultCode& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(ResultCode* other) {
-    if (other == this) return;
-    if (GetArena() == other->GetArena()) {
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ResultCode* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline ResultCode* New() const final {
-    return CreateMaybeMessage<ResultCode>(nullptr);
-  }
-
-  ResultCode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ResultCode>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ResultCode& from);
-  void MergeFrom(const ResultCode& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ResultCode* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "dmonitor.ResultCode";
-  }
-  protected:
-  explicit ResultCode(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_monitor_2eproto);
-    return ::descriptor_table_monitor_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kErrmsgFieldNumber = 2,
-    kErrcodeFieldNumber = 1,
-  };
-  // bytes errmsg = 2;
-  void clear_errmsg();
-  const std::string& errmsg() const;
-  void set_errmsg(const std::string& value);
-  void set_errmsg(std::string&& value);
-  void set_errmsg(const char* value);
-  void set_errmsg(const void* value, size_t size);
-  std::string* mutable_errmsg();
-  std::string* release_errmsg();
-  void set_allocated_errmsg(std::string* errmsg);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_errmsg();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_errmsg(
-      std::string* errmsg);
-  private:
-  const std::string& _internal_errmsg() const;
-  void _internal_set_errmsg(const std::string& value);
-  std::string* _internal_mutable_errmsg();
-  public:
-
-  // int32 errcode = 1;
-  void clear_errcode();
-  ::PROTOBUF_NAMESPACE_ID::int32 errcode() const;
-  void set_errcode(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_errcode() const;
-  void _internal_set_errcode(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:dmonitor.ResultCode)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr errmsg_;
-  ::PROTOBUF_NAMESPACE_ID::int32 errcode_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_monitor_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ReportRequest PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dmonitor.ReportRequest) */ {
- public:
-  inline ReportRequest() : ReportRequest(nullptr) {};
-  virtual ~ReportRequest();
-
-  ReportRequest(const ReportRequest& from);
-  ReportRequest(ReportRequest&& from) noexcept
-    : ReportRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline ReportRequest& operator=(const ReportRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ReportRequest& operator=(ReportRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const ReportRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ReportRequest* internal_default_instance() {
-    return reinterpret_cast<const ReportRequest*>(
-               &_ReportRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    2;
-
-  friend void swap(ReportRequest& a, ReportRequest& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(ReportRequest* other) {
-    if (other == this) return;
-    if (GetArena() == other->GetArena()) {
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ReportRequest* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline ReportRequest* New() const final {
-    return CreateMaybeMessage<ReportRequest>(nullptr);
-  }
-
-  ReportRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ReportRequest>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ReportRequest& from);
-  void MergeFrom(const ReportRequest& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ReportRequest* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "dmonitor.ReportRequest";
-  }
-  protected:
-  explicit ReportRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_monitor_2eproto);
-    return ::descriptor_table_monitor_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kMetricsFieldNumber = 1,
-  };
-  // .dmonitor.MetricsData metrics = 1;
-  bool has_metrics() const;
-  private:
-  bool _internal_has_metrics() const;
-  public:
-  void clear_metrics();
-  const ::dmonitor::MetricsData& metrics() const;
-  ::dmonitor::MetricsData* release_metrics();
-  ::dmonitor::MetricsData* mutable_metrics();
-  void set_allocated_metrics(::dmonitor::MetricsData* metrics);
-  private:
-  const ::dmonitor::MetricsData& _internal_metrics() const;
-  ::dmonitor::MetricsData* _internal_mutable_metrics();
-  public:
-  void unsafe_arena_set_allocated_metrics(
-      ::dmonitor::MetricsData* metrics);
-  ::dmonitor::MetricsData* unsafe_arena_release_metrics();
-
-  // @@protoc_insertion_point(class_scope:dmonitor.ReportRequest)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::dmonitor::MetricsData* metrics_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_monitor_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ReportResponse PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dmonitor.ReportResponse) */ {
- public:
-  inline ReportResponse() : ReportResponse(nullptr) {};
-  virtual ~ReportResponse();
-
-  ReportResponse(const ReportResponse& from);
-  ReportResponse(ReportResponse&& from) noexcept
-    : ReportResponse() {
-    *this = ::std::move(from);
-  }
-
-  inline ReportResponse& operator=(const ReportResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ReportResponse& operator=(ReportResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const ReportResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ReportResponse* internal_default_instance() {
-    return reinterpret_cast<const ReportResponse*>(
-               &_ReportResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    3;
-
-  friend void swap(ReportResponse& a, ReportResponse& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(ReportResponse* other) {
-    if (other == this) return;
-    if (GetArena() == other->GetArena()) {
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(ReportResponse* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline ReportResponse* New() const final {
-    return CreateMaybeMessage<ReportResponse>(nullptr);
-  }
-
-  ReportResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ReportResponse>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ReportResponse& from);
-  void MergeFrom(const ReportResponse& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ReportResponse* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "dmonitor.ReportResponse";
-  }
-  protected:
-  explicit ReportResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_monitor_2eproto);
-    return ::descriptor_table_monitor_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kResultFieldNumber = 1,
-    kSuccessFieldNumber = 2,
-  };
-  // .dmonitor.ResultCode result = 1;
-  bool has_result() const;
-  private:
-  bool _internal_has_result() const;
-  public:
-  void clear_result();
-  const ::dmonitor::ResultCode& result() const;
-  ::dmonitor::ResultCode* release_result();
-  ::dmonitor::ResultCode* mutable_result();
-  void set_allocated_result(::dmonitor::ResultCode* result);
-  private:
-  const ::dmonitor::ResultCode& _internal_result() const;
-  ::dmonitor::ResultCode* _internal_mutable_result();
-  public:
-  void unsafe_arena_set_allocated_result(
-      ::dmonitor::ResultCode* result);
-  ::dmonitor::ResultCode* unsafe_arena_release_result();
-
-  // bool success = 2;
-  void clear_success();
-  bool success() const;
-  void set_success(bool value);
-  private:
-  bool _internal_success() const;
-  void _internal_set_success(bool value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:dmonitor.ReportResponse)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::dmonitor::ResultCode* result_;
-  bool success_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_monitor_2eproto;
-};
-// -------------------------------------------------------------------
-
-class QueryRequest PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dmonitor.QueryRequest) */ {
- public:
-  inline QueryRequest() : QueryRequest(nullptr) {};
-  virtual ~QueryRequest();
-
-  QueryRequest(const QueryRequest& from);
-  QueryRequest(QueryRequest&& from) noexcept
-    : QueryRequest() {
-    *this = ::std::move(from);
-  }
-
-  inline QueryRequest& operator=(const QueryRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline QueryRequest& operator=(QueryRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const QueryRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const QueryRequest* internal_default_instance() {
-    return reinterpret_cast<const QueryRequest*>(
-               &_QueryRequest_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    4;
-
-  friend void swap(QueryRequest& a, QueryRequest& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(QueryRequest* other) {
-    if (other == this) return;
-    if (GetArena() == other->GetArena()) {
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(QueryRequest* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline QueryRequest* New() const final {
-    return CreateMaybeMessage<QueryRequest>(nullptr);
-  }
-
-  QueryRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<QueryRequest>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const QueryRequest& from);
-  void MergeFrom(const QueryRequest& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(QueryRequest* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "dmonitor.QueryRequest";
-  }
-  protected:
-  explicit QueryRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_monitor_2eproto);
-    return ::descriptor_table_monitor_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kServerNameFieldNumber = 1,
-  };
-  // string server_name = 1;
-  void clear_server_name();
-  const std::string& server_name() const;
-  void set_server_name(const std::string& value);
-  void set_server_name(std::string&& value);
-  void set_server_name(const char* value);
-  void set_server_name(const char* value, size_t size);
-  std::string* mutable_server_name();
-  std::string* release_server_name();
-  void set_allocated_server_name(std::string* server_name);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_server_name();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_server_name(
-      std::string* server_name);
-  private:
-  const std::string& _internal_server_name() const;
-  void _internal_set_server_name(const std::string& value);
-  std::string* _internal_mutable_server_name();
-  public:
-
-  // @@protoc_insertion_point(class_scope:dmonitor.QueryRequest)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr server_name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_monitor_2eproto;
-};
-// -------------------------------------------------------------------
-
-class QueryResponse PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:dmonitor.QueryResponse) */ {
- public:
-  inline QueryResponse() : QueryResponse(nullptr) {};
-  virtual ~QueryResponse();
-
-  QueryResponse(const QueryResponse& from);
-  QueryResponse(QueryResponse&& from) noexcept
-    : QueryResponse() {
-    *this = ::std::move(from);
-  }
-
-  inline QueryResponse& operator=(const QueryResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline QueryResponse& operator=(QueryResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const QueryResponse& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const QueryResponse* internal_default_instance() {
-    return reinterpret_cast<const QueryResponse*>(
-               &_QueryResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    5;
-
-  friend void swap(QueryResponse& a, QueryResponse& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(QueryResponse* other) {
-    if (other == this) return;
-    if (GetArena() == other->GetArena()) {
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(QueryResponse* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline QueryResponse* New() const final {
-    return CreateMaybeMessage<QueryResponse>(nullptr);
-  }
-
-  QueryResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<QueryResponse>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const QueryResponse& from);
-  void MergeFrom(const QueryResponse& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(QueryResponse* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "dmonitor.QueryResponse";
-  }
-  protected:
-  explicit QueryResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_monitor_2eproto);
-    return ::descriptor_table_monitor_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kMetricsFieldNumber = 1,
-    kResultFieldNumber = 2,
-    kSuccessFieldNumber = 3,
-  };
-  // repeated .dmonitor.MetricsData metrics = 1;
-  int metrics_size() const;
-  private:
-  int _internal_metrics_size() const;
-  public:
-  void clear_metrics();
-  ::dmonitor::MetricsData* mutable_metrics(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dmonitor::MetricsData >*
-      mutable_metrics();
-  private:
-  const ::dmonitor::MetricsData& _internal_metrics(int index) const;
-  ::dmonitor::MetricsData* _internal_add_metrics();
-  public:
-  const ::dmonitor::MetricsData& metrics(int index) const;
-  ::dmonitor::MetricsData* add_metrics();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dmonitor::MetricsData >&
-      metrics() const;
-
-  // .dmonitor.ResultCode result = 2;
-  bool has_result() const;
-  private:
-  bool _internal_has_result() const;
-  public:
-  void clear_result();
-  const ::dmonitor::ResultCode& result() const;
-  ::dmonitor::ResultCode* release_result();
-  ::dmonitor::ResultCode* mutable_result();
-  void set_allocated_result(::dmonitor::ResultCode* result);
-  private:
-  const ::dmonitor::ResultCode& _internal_result() const;
-  ::dmonitor::ResultCode* _internal_mutable_result();
-  public:
-  void unsafe_arena_set_allocated_result(
-      ::dmonitor::ResultCode* result);
-  ::dmonitor::ResultCode* unsafe_arena_release_result();
-
-  // bool success = 3;
-  void clear_success();
-  bool success() const;
-  void set_success(bool value);
-  private:
-  bool _internal_success() const;
-  void _internal_set_success(bool value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:dmonitor.QueryResponse)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dmonitor::MetricsData > metrics_;
-  ::dmonitor::ResultCode* result_;
-  bool success_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_monitor_2eproto;
-};
-// ===================================================================
-
-class MonitorReportServiceRpc_Stub;
-
-class MonitorReportServiceRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
- protected:
-  // This class should be treated as an abstract interface.
-  inline MonitorReportServiceRpc() {};
- public:
-  virtual ~MonitorReportServiceRpc();
-
-  typedef MonitorReportServiceRpc_Stub Stub;
-
-  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
-
-  virtual void Report(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::dmonitor::ReportRequest* request,
-                       ::dmonitor::ReportResponse* response,
-                       ::google::protobuf::Closure* done);
-
-  // implements Service ----------------------------------------------
-
-  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
-  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
-                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
-                  ::PROTOBUF_NAMESPACE_ID::Message* response,
-                  ::google::protobuf::Closure* done);
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
-
- private:
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(MonitorReportServiceRpc);
-};
-
-class MonitorReportServiceRpc_Stub : public MonitorReportServiceRpc {
- public:
-  MonitorReportServiceRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
-  MonitorReportServiceRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
-                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
-  ~MonitorReportServiceRpc_Stub();
-
-  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
-
-  // implements MonitorReportServiceRpc ------------------------------------------
-
-  void Report(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::dmonitor::ReportRequest* request,
-                       ::dmonitor::ReportResponse* response,
-                       ::google::protobuf::Closure* done);
- private:
-  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
-  bool owns_channel_;
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(MonitorReportServiceRpc_Stub);
-};
-
-
-// -------------------------------------------------------------------
-
-class MonitorQueryServiceRpc_Stub;
-
-class MonitorQueryServiceRpc : public ::PROTOBUF_NAMESPACE_ID::Service {
- protected:
-  // This class should be treated as an abstract interface.
-  inline MonitorQueryServiceRpc() {};
- public:
-  virtual ~MonitorQueryServiceRpc();
-
-  typedef MonitorQueryServiceRpc_Stub Stub;
-
-  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
-
-  virtual void Query(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::dmonitor::QueryRequest* request,
-                       ::dmonitor::QueryResponse* response,
-                       ::google::protobuf::Closure* done);
-
-  // implements Service ----------------------------------------------
-
-  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
-  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
-                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
-                  ::PROTOBUF_NAMESPACE_ID::Message* response,
-                  ::google::protobuf::Closure* done);
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
-  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
-    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
-
- private:
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(MonitorQueryServiceRpc);
-};
-
-class MonitorQueryServiceRpc_Stub : public MonitorQueryServiceRpc {
- public:
-  MonitorQueryServiceRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
-  MonitorQueryServiceRpc_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
-                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
-  ~MonitorQueryServiceRpc_Stub();
-
-  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
-
-  // implements MonitorQueryServiceRpc ------------------------------------------
-
-  void Query(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
-                       const ::dmonitor::QueryRequest* request,
-                       ::dmonitor::QueryResponse* response,
-                       ::google::protobuf::Closure* done);
- private:
-  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
-  bool owns_channel_;
-  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(MonitorQueryServiceRpc_Stub);
-};
-
-
-// ===================================================================
-
-
-// ===================================================================
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// MetricsData
-
-// string server_name = 1;
-inline void MetricsData::clear_server_name() {
-  server_name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& MetricsData::server_name() const {
-  // @@protoc_insertion_point(field_get:dmonitor.MetricsData.server_name)
-  return _internal_server_name();
-}
-inline void MetricsData::set_server_name(const std::string& value) {
-  _internal_set_server_name(value);
-  // @@protoc_insertion_point(field_set:dmonitor.MetricsData.server_name)
-}
-inline std::string* MetricsData::mutable_server_name() {
-  // @@protoc_insertion_point(field_mutable:dmonitor.MetricsData.server_name)
-  return _internal_mutable_server_name();
-}
-inline const std::string& MetricsData::_internal_server_name() const {
-  return server_name_.Get();
-}
-inline void MetricsData::_internal_set_server_name(const std::string& value) {
-  
-  server_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void MetricsData::set_server_name(std::string&& value) {
-  
-  server_name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:dmonitor.MetricsData.server_name)
-}
-inline void MetricsData::set_server_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  server_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:dmonitor.MetricsData.server_name)
-}
-inline void MetricsData::set_server_name(const char* value,
-    size_t size) {
-  
-  server_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:dmonitor.MetricsData.server_name)
-}
-inline std::string* MetricsData::_internal_mutable_server_name() {
-  
-  return server_name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* MetricsData::release_server_name() {
-  // @@protoc_insertion_point(field_release:dmonitor.MetricsData.server_name)
-  return server_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void MetricsData::set_allocated_server_name(std::string* server_name) {
-  if (server_name != nullptr) {
-    
-  } else {
-    
-  }
-  server_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), server_name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:dmonitor.MetricsData.server_name)
-}
-inline std::string* MetricsData::unsafe_arena_release_server_name() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:dmonitor.MetricsData.server_name)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return server_name_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void MetricsData::unsafe_arena_set_allocated_server_name(
-    std::string* server_name) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (server_name != nullptr) {
-    
-  } else {
-    
-  }
-  server_name_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      server_name, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dmonitor.MetricsData.server_name)
-}
-
-// int64 timestamp = 2;
-inline void MetricsData::clear_timestamp() {
-  timestamp_ = PROTOBUF_LONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::int64 MetricsData::_internal_timestamp() const {
-  return timestamp_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int64 MetricsData::timestamp() const {
-  // @@protoc_insertion_point(field_get:dmonitor.MetricsData.timestamp)
-  return _internal_timestamp();
-}
-inline void MetricsData::_internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  
-  timestamp_ = value;
-}
-inline void MetricsData::set_timestamp(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _internal_set_timestamp(value);
-  // @@protoc_insertion_point(field_set:dmonitor.MetricsData.timestamp)
-}
-
-// float cpu_usage = 3;
-inline void MetricsData::clear_cpu_usage() {
-  cpu_usage_ = 0;
-}
-inline float MetricsData::_internal_cpu_usage() const {
-  return cpu_usage_;
-}
-inline float MetricsData::cpu_usage() const {
-  // @@protoc_insertion_point(field_get:dmonitor.MetricsData.cpu_usage)
-  return _internal_cpu_usage();
-}
-inline void MetricsData::_internal_set_cpu_usage(float value) {
-  
-  cpu_usage_ = value;
-}
-inline void MetricsData::set_cpu_usage(float value) {
-  _internal_set_cpu_usage(value);
-  // @@protoc_insertion_point(field_set:dmonitor.MetricsData.cpu_usage)
-}
-
-// float memory_usage = 4;
-inline void MetricsData::clear_memory_usage() {
-  memory_usage_ = 0;
-}
-inline float MetricsData::_internal_memory_usage() const {
-  return memory_usage_;
-}
-inline float MetricsData::memory_usage() const {
-  // @@protoc_insertion_point(field_get:dmonitor.MetricsData.memory_usage)
-  return _internal_memory_usage();
-}
-inline void MetricsData::_internal_set_memory_usage(float value) {
-  
-  memory_usage_ = value;
-}
-inline void MetricsData::set_memory_usage(float value) {
-  _internal_set_memory_usage(value);
-  // @@protoc_insertion_point(field_set:dmonitor.MetricsData.memory_usage)
-}
-
-// -------------------------------------------------------------------
-
-// ResultCode
-
-// int32 errcode = 1;
-inline void ResultCode::clear_errcode() {
-  errcode_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 ResultCode::_internal_errcode() const {
-  return errcode_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 ResultCode::errcode() const {
-  // @@protoc_insertion_point(field_get:dmonitor.ResultCode.errcode)
-  return _internal_errcode();
-}
-inline void ResultCode::_internal_set_errcode(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  errcode_ = value;
-}
-inline void ResultCode::set_errcode(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_errcode(value);
-  // @@protoc_insertion_point(field_set:dmonitor.ResultCode.errcode)
-}
-
-// bytes errmsg = 2;
-inline void ResultCode::clear_errmsg() {
-  errmsg_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& ResultCode::errmsg() const {
-  // @@protoc_insertion_point(field_get:dmonitor.ResultCode.errmsg)
-  return _internal_errmsg();
-}
-inline void ResultCode::set_errmsg(const std::string& value) {
-  _internal_set_errmsg(value);
-  // @@protoc_insertion_point(field_set:dmonitor.ResultCode.errmsg)
-}
-inline std::string* ResultCode::mutable_errmsg() {
-  // @@protoc_insertion_point(field_mutable:dmonitor.ResultCode.errmsg)
-  return _internal_mutable_errmsg();
-}
-inline const std::string& ResultCode::_internal_errmsg() const {
-  return errmsg_.Get();
-}
-inline void ResultCode::_internal_set_errmsg(const std::string& value) {
-  
-  errmsg_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void ResultCode::set_errmsg(std::string&& value) {
-  
-  errmsg_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:dmonitor.ResultCode.errmsg)
-}
-inline void ResultCode::set_errmsg(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  errmsg_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:dmonitor.ResultCode.errmsg)
-}
-inline void ResultCode::set_errmsg(const void* value,
-    size_t size) {
-  
-  errmsg_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:dmonitor.ResultCode.errmsg)
-}
-inline std::string* ResultCode::_internal_mutable_errmsg() {
-  
-  return errmsg_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* ResultCode::release_errmsg() {
-  // @@protoc_insertion_point(field_release:dmonitor.ResultCode.errmsg)
-  return errmsg_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void ResultCode::set_allocated_errmsg(std::string* errmsg) {
-  if (errmsg != nullptr) {
-    
-  } else {
-    
-  }
-  errmsg_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), errmsg,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:dmonitor.ResultCode.errmsg)
-}
-inline std::string* ResultCode::unsafe_arena_release_errmsg() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:dmonitor.ResultCode.errmsg)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return errmsg_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void ResultCode::unsafe_arena_set_allocated_errmsg(
-    std::string* errmsg) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (errmsg != nullptr) {
-    
-  } else {
-    
-  }
-  errmsg_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      errmsg, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dmonitor.ResultCode.errmsg)
-}
-
-// -------------------------------------------------------------------
-
-// ReportRequest
-
-// .dmonitor.MetricsData metrics = 1;
-inline bool ReportRequest::_internal_has_metrics() const {
-  return this != internal_default_instance() && metrics_ != nullptr;
-}
-inline bool ReportRequest::has_metrics() const {
-  return _internal_has_metrics();
-}
-inline void ReportRequest::clear_metrics() {
-  if (GetArena() == nullptr && metrics_ != nullptr) {
-    delete metrics_;
-  }
-  metrics_ = nullptr;
-}
-inline const ::dmonitor::MetricsData& ReportRequest::_internal_metrics() const {
-  const ::dmonitor::MetricsData* p = metrics_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::dmonitor::MetricsData*>(
-      &::dmonitor::_MetricsData_default_instance_);
-}
-inline const ::dmonitor::MetricsData& ReportRequest::metrics() const {
-  // @@protoc_insertion_point(field_get:dmonitor.ReportRequest.metrics)
-  return _internal_metrics();
-}
-inline void ReportRequest::unsafe_arena_set_allocated_metrics(
-    ::dmonitor::MetricsData* metrics) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(metrics_);
-  }
-  metrics_ = metrics;
-  if (metrics) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dmonitor.ReportRequest.metrics)
-}
-inline ::dmonitor::MetricsData* ReportRequest::release_metrics() {
-  auto temp = unsafe_arena_release_metrics();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
-}
-inline ::dmonitor::MetricsData* ReportRequest::unsafe_arena_release_metrics() {
-  // @@protoc_insertion_point(field_release:dmonitor.ReportRequest.metrics)
-  
-  ::dmonitor::MetricsData* temp = metrics_;
-  metrics_ = nullptr;
-  return temp;
-}
-inline ::dmonitor::MetricsData* ReportRequest::_internal_mutable_metrics() {
-  
-  if (metrics_ == nullptr) {
-    auto* p = CreateMaybeMessage<::dmonitor::MetricsData>(GetArena());
-    metrics_ = p;
-  }
-  return metrics_;
-}
-inline ::dmonitor::MetricsData* ReportRequest::mutable_metrics() {
-  // @@protoc_insertion_point(field_mutable:dmonitor.ReportRequest.metrics)
-  return _internal_mutable_metrics();
-}
-inline void ReportRequest::set_allocated_metrics(::dmonitor::MetricsData* metrics) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete metrics_;
-  }
-  if (metrics) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(metrics);
-    if (message_arena != submessage_arena) {
-      metrics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, metrics, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  metrics_ = metrics;
-  // @@protoc_insertion_point(field_set_allocated:dmonitor.ReportRequest.metrics)
-}
-
-// -------------------------------------------------------------------
-
-// ReportResponse
-
-// .dmonitor.ResultCode result = 1;
-inline bool ReportResponse::_internal_has_result() const {
-  return this != internal_default_instance() && result_ != nullptr;
-}
-inline bool ReportResponse::has_result() const {
-  return _internal_has_result();
-}
-inline void ReportResponse::clear_result() {
-  if (GetArena() == nullptr && result_ != nullptr) {
-    delete result_;
-  }
-  result_ = nullptr;
-}
-inline const ::dmonitor::ResultCode& ReportResponse::_internal_result() const {
-  const ::dmonitor::ResultCode* p = result_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::dmonitor::ResultCode*>(
-      &::dmonitor::_ResultCode_default_instance_);
-}
-inline const ::dmonitor::ResultCode& ReportResponse::result() const {
-  // @@protoc_insertion_point(field_get:dmonitor.ReportResponse.result)
-  return _internal_result();
-}
-inline void ReportResponse::unsafe_arena_set_allocated_result(
-    ::dmonitor::ResultCode* result) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
-  }
-  result_ = result;
-  if (result) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dmonitor.ReportResponse.result)
-}
-inline ::dmonitor::ResultCode* ReportResponse::release_result() {
-  auto temp = unsafe_arena_release_result();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
-}
-inline ::dmonitor::ResultCode* ReportResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:dmonitor.ReportResponse.result)
-  
-  ::dmonitor::ResultCode* temp = result_;
-  result_ = nullptr;
-  return temp;
-}
-inline ::dmonitor::ResultCode* ReportResponse::_internal_mutable_result() {
-  
-  if (result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::dmonitor::ResultCode>(GetArena());
-    result_ = p;
-  }
-  return result_;
-}
-inline ::dmonitor::ResultCode* ReportResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:dmonitor.ReportResponse.result)
-  return _internal_mutable_result();
-}
-inline void ReportResponse::set_allocated_result(::dmonitor::ResultCode* result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete result_;
-  }
-  if (result) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
-    if (message_arena != submessage_arena) {
-      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, result, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:dmonitor.ReportResponse.result)
-}
-
-// bool success = 2;
-inline void ReportResponse::clear_success() {
-  success_ = false;
-}
-inline bool ReportResponse::_internal_success() const {
-  return success_;
-}
-inline bool ReportResponse::success() const {
-  // @@protoc_insertion_point(field_get:dmonitor.ReportResponse.success)
-  return _internal_success();
-}
-inline void ReportResponse::_internal_set_success(bool value) {
-  
-  success_ = value;
-}
-inline void ReportResponse::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:dmonitor.ReportResponse.success)
-}
-
-// -------------------------------------------------------------------
-
-// QueryRequest
-
-// string server_name = 1;
-inline void QueryRequest::clear_server_name() {
-  server_name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& QueryRequest::server_name() const {
-  // @@protoc_insertion_point(field_get:dmonitor.QueryRequest.server_name)
-  return _internal_server_name();
-}
-inline void QueryRequest::set_server_name(const std::string& value) {
-  _internal_set_server_name(value);
-  // @@protoc_insertion_point(field_set:dmonitor.QueryRequest.server_name)
-}
-inline std::string* QueryRequest::mutable_server_name() {
-  // @@protoc_insertion_point(field_mutable:dmonitor.QueryRequest.server_name)
-  return _internal_mutable_server_name();
-}
-inline const std::string& QueryRequest::_internal_server_name() const {
-  return server_name_.Get();
-}
-inline void QueryRequest::_internal_set_server_name(const std::string& value) {
-  
-  server_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void QueryRequest::set_server_name(std::string&& value) {
-  
-  server_name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:dmonitor.QueryRequest.server_name)
-}
-inline void QueryRequest::set_server_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  server_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:dmonitor.QueryRequest.server_name)
-}
-inline void QueryRequest::set_server_name(const char* value,
-    size_t size) {
-  
-  server_name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:dmonitor.QueryRequest.server_name)
-}
-inline std::string* QueryRequest::_internal_mutable_server_name() {
-  
-  return server_name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* QueryRequest::release_server_name() {
-  // @@protoc_insertion_point(field_release:dmonitor.QueryRequest.server_name)
-  return server_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void QueryRequest::set_allocated_server_name(std::string* server_name) {
-  if (server_name != nullptr) {
-    
-  } else {
-    
-  }
-  server_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), server_name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:dmonitor.QueryRequest.server_name)
-}
-inline std::string* QueryRequest::unsafe_arena_release_server_name() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:dmonitor.QueryRequest.server_name)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return server_name_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void QueryRequest::unsafe_arena_set_allocated_server_name(
-    std::string* server_name) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (server_name != nullptr) {
-    
-  } else {
-    
-  }
-  server_name_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      server_name, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dmonitor.QueryRequest.server_name)
-}
-
-// -------------------------------------------------------------------
-
-// QueryResponse
-
-// repeated .dmonitor.MetricsData metrics = 1;
-inline int QueryResponse::_internal_metrics_size() const {
-  return metrics_.size();
-}
-inline int QueryResponse::metrics_size() const {
-  return _internal_metrics_size();
-}
-inline void QueryResponse::clear_metrics() {
-  metrics_.Clear();
-}
-inline ::dmonitor::MetricsData* QueryResponse::mutable_metrics(int index) {
-  // @@protoc_insertion_point(field_mutable:dmonitor.QueryResponse.metrics)
-  return metrics_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dmonitor::MetricsData >*
-QueryResponse::mutable_metrics() {
-  // @@protoc_insertion_point(field_mutable_list:dmonitor.QueryResponse.metrics)
-  return &metrics_;
-}
-inline const ::dmonitor::MetricsData& QueryResponse::_internal_metrics(int index) const {
-  return metrics_.Get(index);
-}
-inline const ::dmonitor::MetricsData& QueryResponse::metrics(int index) const {
-  // @@protoc_insertion_point(field_get:dmonitor.QueryResponse.metrics)
-  return _internal_metrics(index);
-}
-inline ::dmonitor::MetricsData* QueryResponse::_internal_add_metrics() {
-  return metrics_.Add();
-}
-inline ::dmonitor::MetricsData* QueryResponse::add_metrics() {
-  // @@protoc_insertion_point(field_add:dmonitor.QueryResponse.metrics)
-  return _internal_add_metrics();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::dmonitor::MetricsData >&
-QueryResponse::metrics() const {
-  // @@protoc_insertion_point(field_list:dmonitor.QueryResponse.metrics)
-  return metrics_;
-}
-
-// .dmonitor.ResultCode result = 2;
-inline bool QueryResponse::_internal_has_result() const {
-  return this != internal_default_instance() && result_ != nullptr;
-}
-inline bool QueryResponse::has_result() const {
-  return _internal_has_result();
-}
-inline void QueryResponse::clear_result() {
-  if (GetArena() == nullptr && result_ != nullptr) {
-    delete result_;
-  }
-  result_ = nullptr;
-}
-inline const ::dmonitor::ResultCode& QueryResponse::_internal_result() const {
-  const ::dmonitor::ResultCode* p = result_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::dmonitor::ResultCode*>(
-      &::dmonitor::_ResultCode_default_instance_);
-}
-inline const ::dmonitor::ResultCode& QueryResponse::result() const {
-  // @@protoc_insertion_point(field_get:dmonitor.QueryResponse.result)
-  return _internal_result();
-}
-inline void QueryResponse::unsafe_arena_set_allocated_result(
-    ::dmonitor::ResultCode* result) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
-  }
-  result_ = result;
-  if (result) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:dmonitor.QueryResponse.result)
-}
-inline ::dmonitor::ResultCode* QueryResponse::release_result() {
-  auto temp = unsafe_arena_release_result();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
-}
-inline ::dmonitor::ResultCode* QueryResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:dmonitor.QueryResponse.result)
-  
-  ::dmonitor::ResultCode* temp = result_;
-  result_ = nullptr;
-  return temp;
-}
-inline ::dmonitor::ResultCode* QueryResponse::_internal_mutable_result() {
-  
-  if (result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::dmonitor::ResultCode>(GetArena());
-    result_ = p;
-  }
-  return result_;
-}
-inline ::dmonitor::ResultCode* QueryResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:dmonitor.QueryResponse.result)
-  return _internal_mutable_result();
-}
-inline void QueryResponse::set_allocated_result(::dmonitor::ResultCode* result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete result_;
-  }
-  if (result) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
-    if (message_arena != submessage_arena) {
-      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, result, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:dmonitor.QueryResponse.result)
-}
-
-// bool success = 3;
-inline void QueryResponse::clear_success() {
-  success_ = false;
-}
-inline bool QueryResponse::_internal_success() const {
-  return success_;
-}
-inline bool QueryResponse::success() const {
-  // @@protoc_insertion_point(field_get:dmonitor.QueryResponse.success)
-  return _internal_success();
-}
-inline void QueryResponse::_internal_set_success(bool value) {
-  
-  success_ = value;
-}
-inline void QueryResponse::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:dmonitor.QueryResponse.success)
-}
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace dmonitor
-
-// @@protoc_insertion_point(global_scope)
-
-#include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_monitor_2eproto
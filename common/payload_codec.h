@@ -0,0 +1,98 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include <zlib.h>
+
+#include "monitor.pb.h"
+
+// 查询响应的负载压缩. krpc的RpcHeader在库里改不了, 压缩放在消息这一层协商:
+// 客户端在请求的accept_codecs里列出能解的编码, center只在响应序列化后不小于阈值、
+// 而且客户端接受时, 把整个响应序列化压缩后放进compressed, 其他字段清空.
+// 全量概览里重复的主机名、缓慢变化的浮点数压缩效果都很好. 服务端和客户端共用, 只有头文件.
+namespace payload {
+
+static constexpr size_t DEFAULT_MIN_BYTES = 1024; // 更小的响应压缩省不了几个字节, 不值得花CPU
+static constexpr size_t MAX_RAW_BYTES = 64 << 20;  // raw_size来自网络, 超过这个数当作损坏的数据
+
+// zlib最快的一档, 压缩后没有变小返回false.
+// 每次compress2都要分配并清零几百KB的压缩状态, 小响应上这比压缩本身还贵, 所以每个线程留一个z_stream复用
+inline bool Compress(const std::string& raw, std::string* out) {
+    struct Deflater {
+        z_stream stream{};
+        bool ok = deflateInit(&stream, Z_BEST_SPEED) == Z_OK;
+        ~Deflater() { deflateEnd(&stream); }
+    };
+    thread_local Deflater deflater;
+    z_stream& stream = deflater.stream;
+    if (!deflater.ok || deflateReset(&stream) != Z_OK) {
+        out->clear();
+        return false;
+    }
+    out->resize(deflateBound(&stream, raw.size()));
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(raw.data()));
+    stream.avail_in = static_cast<uInt>(raw.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&(*out)[0]);
+    stream.avail_out = static_cast<uInt>(out->size());
+    if (deflate(&stream, Z_FINISH) != Z_STREAM_END || stream.total_out >= raw.size()) {
+        out->clear();
+        return false;
+    }
+    out->resize(stream.total_out);
+    return true;
+}
+
+// raw_size是压缩前的字节数, 解出来的长度不一致也算失败
+inline bool Decompress(const std::string& in, size_t raw_size, std::string* out) {
+    if (raw_size > MAX_RAW_BYTES) {
+        return false;
+    }
+    out->resize(raw_size);
+    uLongf size = raw_size;
+    return uncompress(reinterpret_cast<Bytef*>(&(*out)[0]), &size,
+                      reinterpret_cast<const Bytef*>(in.data()), in.size()) == Z_OK &&
+           size == raw_size;
+}
+
+template <typename Request>
+bool Accepts(const Request& request, dmonitor::Codec codec) {
+    const auto& codecs = request.accept_codecs();
+    return std::find(codecs.begin(), codecs.end(), codec) != codecs.end();
+}
+
+// 服务端: 在done->Run()之前调用, 响应够大且客户端接受zlib时换成压缩的形式
+template <typename Request, typename Response>
+void CompressResponse(const Request& request, Response* response, size_t min_bytes) {
+    if (!Accepts(request, dmonitor::CODEC_ZLIB) || response->ByteSizeLong() < min_bytes) {
+        return;
+    }
+    // 工作线程和IO线程各用自己的缓冲区, 稳定后不再分配
+    thread_local std::string raw;
+    thread_local std::string packed;
+    response->SerializeToString(&raw);
+    if (!Compress(raw, &packed)) {
+        return;
+    }
+    response->Clear();
+    response->set_codec(dmonitor::CODEC_ZLIB);
+    response->set_raw_size(static_cast<uint32_t>(raw.size()));
+    response->set_compressed(packed);
+}
+
+// 客户端: 收到压缩的响应就原地还原, 没压缩的原样返回true; 不认识的编码或数据损坏返回false
+template <typename Response>
+bool DecompressResponse(Response* response) {
+    if (response->codec() == dmonitor::CODEC_NONE) {
+        return true;
+    }
+    std::string raw;
+    if (response->codec() != dmonitor::CODEC_ZLIB ||
+        !Decompress(response->compressed(), response->raw_size(), &raw)) {
+        return false;
+    }
+    return response->ParseFromString(raw);
+}
+
+} // namespace payload
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+
+#include "async_logging.h"
+
+namespace {
+
+std::string ReadFile(const std::string& path) {
+    std::ifstream in(path);
+    std::stringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+
+} // namespace
+
+TEST(AsyncLoggingTest, LongMessagesAreNotTruncated) {
+    std::string path = testing::TempDir() + "async_logging_" + std::to_string(getpid()) + ".log";
+    unlink(path.c_str());
+    AsyncLogger& logger = AsyncLogger::Instance();
+    ASSERT_TRUE(logger.SetOutput(path));
+
+    // 比Logf栈上的1024字节缓冲区长得多的多行文本, 两条路径都要原样写出
+    std::string status = "\n=== Server Status ===\n";
+    for (int i = 0; i < 200; ++i) {
+        status += "host-" + std::to_string(i) + ": ONLINE (last seen 1s ago)\n";
+    }
+    status += "=====================\n";
+    ASSERT_GT(status.size(), 4096u);
+    ALOG(INFO, "%s", status.c_str());
+    logger.Log(LogSeverity::INFO, __FILE__, __LINE__, status.data(), status.size());
+    // 刚好放满缓冲区和多一个字节的边界
+    ALOG(INFO, "%s", std::string(1023, 'a').c_str());
+    ALOG(INFO, "%s", std::string(1024, 'b').c_str());
+    logger.Flush();
+    ASSERT_TRUE(logger.SetOutput(""));
+
+    std::string content = ReadFile(path);
+    size_t first = content.find(status);
+    ASSERT_NE(first, std::string::npos);
+    EXPECT_NE(content.find(status, first + status.size()), std::string::npos);
+    EXPECT_NE(content.find(std::string(1023, 'a') + "\n"), std::string::npos);
+    EXPECT_NE(content.find(std::string(1024, 'b') + "\n"), std::string::npos);
+    unlink(path.c_str());
+}
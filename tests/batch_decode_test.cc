@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+
+#include "batch_decode.h"
+
+namespace {
+
+dmonitor::ReportBatchRequest MakeBatch(std::initializer_list<int64_t> timestamps, std::initializer_list<int32_t> cpus,
+                                       std::initializer_list<int32_t> memories) {
+    dmonitor::ReportBatchRequest batch;
+    for (int64_t delta : timestamps) {
+        batch.add_timestamp_deltas(delta);
+    }
+    for (int32_t delta : cpus) {
+        batch.add_cpu_deltas(delta);
+    }
+    for (int32_t delta : memories) {
+        batch.add_memory_deltas(delta);
+    }
+    return batch;
+}
+
+} // namespace
+
+TEST(BatchDecodeTest, RestoresDeltas) {
+    std::vector<Sample> samples;
+    ASSERT_TRUE(DecodeBatch(MakeBatch({1000, 250, 250}, {2500, 100, -50}, {6000, 0, 10000 - 6000}), &samples));
+    ASSERT_EQ(samples.size(), 3u);
+    EXPECT_EQ(samples[0].timestamp, 1000);
+    EXPECT_EQ(samples[2].timestamp, 1500);
+    EXPECT_FLOAT_EQ(samples[0].cpu_usage, 25.0f);
+    EXPECT_FLOAT_EQ(samples[2].cpu_usage, 25.5f);
+    EXPECT_FLOAT_EQ(samples[2].memory_usage, 100.0f);
+}
+
+TEST(BatchDecodeTest, RejectsMismatchedLengths) {
+    std::vector<Sample> samples;
+    EXPECT_FALSE(DecodeBatch(MakeBatch({1000, 250}, {2500}, {6000, 0}), &samples));
+}
+
+TEST(BatchDecodeTest, RejectsUsageOutOfRange) {
+    const int32_t max = std::numeric_limits<int32_t>::max();
+    std::vector<Sample> samples;
+    // 以前用int32累加, 这样的差分会有符号溢出
+    EXPECT_FALSE(DecodeBatch(MakeBatch({1000, 250, 250}, {max, max, 2}, {0, 0, 0}), &samples));
+    samples.clear();
+    EXPECT_FALSE(DecodeBatch(MakeBatch({1000}, {10001}, {0}), &samples));
+    samples.clear();
+    EXPECT_FALSE(DecodeBatch(MakeBatch({1000, 250}, {0, 0}, {100, -101}), &samples));
+}
+
+TEST(BatchDecodeTest, RejectsTimestampOverflow) {
+    const int64_t max = std::numeric_limits<int64_t>::max();
+    std::vector<Sample> samples;
+    EXPECT_FALSE(DecodeBatch(MakeBatch({max, 1}, {0, 0}, {0, 0}), &samples));
+    samples.clear();
+    EXPECT_FALSE(DecodeBatch(MakeBatch({1000, -2000}, {0, 0}, {0, 0}), &samples));
+}
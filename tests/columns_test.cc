@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "columns.h"
+#include "metrics_storage.h"
+
+TEST(ColumnsTest, RecentCopiesOnlyNewerRowsAndNonEmptyColumns) {
+    ColumnStore store(4);
+    // 写6行, 环里剩下时间戳3..6; 磁盘sda只在第3行出现
+    for (int64_t ts = 1; ts <= 6; ++ts) {
+        store.BeginRow(ts);
+        store.Set(ColumnKind::LOAD1, 0, {}, static_cast<float>(ts));
+        if (ts == 3) {
+            store.Set(ColumnKind::DISK_READ, 0, "sda", 1.0f);
+        }
+    }
+
+    ColumnStore recent = store.Recent(5);
+    ASSERT_EQ(recent.size(), 2u);
+    EXPECT_EQ(recent.timestamp(0), 5);
+    EXPECT_EQ(recent.timestamp(1), 6);
+    // sda在这两行都没有值, 不拷贝
+    ASSERT_EQ(recent.column_count(), 1u);
+    EXPECT_EQ(recent.kind(0), ColumnKind::LOAD1);
+    EXPECT_EQ(recent.value(0, 0), 5.0f);
+    EXPECT_EQ(recent.value(0, 1), 6.0f);
+
+    EXPECT_EQ(store.Recent(0).size(), 4u);
+    EXPECT_TRUE(store.Recent(7).empty());
+}
+
+TEST(ColumnsTest, ContainerHistoryKeepsItsOwnCapacity) {
+    MetricsStorage storage;
+    storage.SetHistoryCapacity(50);
+    storage.SetContainerHistoryCapacity(5);
+    uint32_t id = storage.Register("host");
+    ASSERT_NE(id, 0u);
+    for (int64_t ts = 1; ts <= 20; ++ts) {
+        dmonitor::MetricsData metrics;
+        metrics.set_timestamp(ts);
+        metrics.set_cpu_usage(1.0f);
+        metrics.set_load1(static_cast<float>(ts));
+        dmonitor::CgroupInfo* cgroup = metrics.add_cgroups();
+        cgroup->set_path("/docker/a");
+        cgroup->set_cpu_usage(static_cast<float>(ts));
+        cgroup->set_memory_bytes(1024);
+        ASSERT_TRUE(storage.AddMetrics(id, metrics));
+    }
+
+    google::protobuf::RepeatedPtrField<dmonitor::MetricsData> result;
+    storage.QueryMetrics("host", &result);
+    ASSERT_EQ(result.size(), 20);
+    for (const auto& data : result) {
+        // 其他扩展指标每一行都有, 容器只有最近5行
+        EXPECT_EQ(data.load1(), static_cast<float>(data.timestamp()));
+        if (data.timestamp() > 15) {
+            ASSERT_EQ(data.cgroups_size(), 1) << data.timestamp();
+            EXPECT_EQ(data.cgroups(0).path(), "/docker/a");
+            EXPECT_EQ(data.cgroups(0).cpu_usage(), static_cast<float>(data.timestamp()));
+            EXPECT_EQ(data.cgroups(0).memory_bytes(), 1024u);
+        } else {
+            EXPECT_EQ(data.cgroups_size(), 0) << data.timestamp();
+        }
+    }
+}
+
+TEST(ColumnsTest, HeartbeatCarriesExtendedMetrics) {
+    MetricsStorage storage;
+    uint32_t id = storage.Register("host");
+    ASSERT_NE(id, 0u);
+    std::vector<Sample> samples{{1000, 10.0f, 20.0f}};
+    ASSERT_EQ(storage.AddBatch(id, &samples, nullptr), 1u);
+
+    // 死区模式下的心跳: 没有点, 扩展指标打在sampled_until上
+    dmonitor::MetricsData extended;
+    extended.set_timestamp(5000);
+    extended.set_load1(3.0f);
+    ASSERT_TRUE(storage.Touch(id, 5000, &extended));
+    // 时间戳对不上的扩展指标不写
+    extended.set_timestamp(8000);
+    extended.set_load1(4.0f);
+    ASSERT_TRUE(storage.Touch(id, 9000, &extended));
+
+    google::protobuf::RepeatedPtrField<dmonitor::MetricsData> result;
+    storage.QueryMetrics("host", &result);
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result.Get(0).timestamp(), 1000);
+    EXPECT_EQ(result.Get(0).load1(), 0.0f);
+    EXPECT_EQ(result.Get(1).timestamp(), 9000);
+    EXPECT_EQ(result.Get(1).load1(), 0.0f);
+
+    extended.set_timestamp(12000);
+    extended.set_load1(5.0f);
+    ASSERT_TRUE(storage.Touch(id, 12000, &extended));
+    storage.QueryMetrics("host", &result);
+    ASSERT_EQ(result.size(), 2);
+    EXPECT_EQ(result.Get(1).timestamp(), 12000);
+    EXPECT_EQ(result.Get(1).cpu_usage(), 10.0f);
+    EXPECT_EQ(result.Get(1).load1(), 5.0f);
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "metrics_storage.h"
+
+// 所有服务器的查询只读seqlock发布的最新值, 写入再多也不应该把读的尾延迟拖上去
+TEST(LatestTableTest, OverviewQueryP99UnderConcurrentWrites) {
+    constexpr int kSeries = 1000;
+    // 读线程要有自己的核, 否则测到的是调度器的时间片, 不是读路径本身
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    const int kWriters = static_cast<int>(std::clamp(cores - 1, 1u, 4u));
+    constexpr int kQueries = 2000;
+    // 调试构建(-O0)下也要满足的上限, 留足余量; 实际数值打印在输出里
+    constexpr double kP99LimitUs = 20000;
+
+    MetricsStorage storage;
+    std::vector<uint32_t> ids;
+    for (int i = 0; i < kSeries; ++i) {
+        ids.push_back(storage.Register("host-" + std::to_string(i)));
+        ASSERT_NE(ids.back(), 0u);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> writes{0};
+    std::vector<std::thread> writers;
+    for (int w = 0; w < kWriters; ++w) {
+        writers.emplace_back([&, w] {
+            dmonitor::MetricsData metrics;
+            for (int64_t ts = 1; !stop.load(std::memory_order_relaxed); ++ts) {
+                for (int i = w; i < kSeries; i += kWriters) {
+                    metrics.set_timestamp(ts);
+                    metrics.set_cpu_usage(static_cast<float>(ts % 100));
+                    metrics.set_memory_usage(static_cast<float>(i % 100));
+                    storage.AddMetrics(ids[i], metrics);
+                    writes.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    google::protobuf::RepeatedPtrField<dmonitor::MetricsData> result;
+    std::vector<double> latencies_us;
+    latencies_us.reserve(kQueries);
+    for (int q = 0; q < kQueries; ++q) {
+        auto start = std::chrono::steady_clock::now();
+        storage.QueryMetrics("", &result);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        latencies_us.push_back(std::chrono::duration<double, std::micro>(elapsed).count());
+    }
+    stop = true;
+    for (auto& writer : writers) {
+        writer.join();
+    }
+
+    std::sort(latencies_us.begin(), latencies_us.end());
+    double p50 = latencies_us[kQueries / 2];
+    double p99 = latencies_us[kQueries * 99 / 100];
+    printf("QueryMetrics(\"\") over %d series with %d writers (%llu writes): p50 %.1f us, p99 %.1f us\n",
+           kSeries, kWriters, static_cast<unsigned long long>(writes.load()), p50, p99);
+    RecordProperty("p50_us", static_cast<int>(p50));
+    RecordProperty("p99_us", static_cast<int>(p99));
+    EXPECT_EQ(result.size(), kSeries);
+    if (cores > 1) {
+        EXPECT_LT(p99, kP99LimitUs);
+    } else {
+        printf("single core: p99 only reported, not checked\n");
+    }
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "monitor.pb.h"
+#include "payload_codec.h"
+
+namespace {
+
+dmonitor::QueryResponse MakeOverview(int hosts) {
+    dmonitor::QueryResponse response;
+    for (int i = 0; i < hosts; ++i) {
+        dmonitor::MetricsData* data = response.add_metrics();
+        data->set_server_name("web-" + std::to_string(i) + ".prod");
+        data->set_timestamp(1700000000000LL + i);
+        data->set_cpu_usage(static_cast<float>(i % 100));
+        data->set_memory_usage(50.0f);
+    }
+    response.set_success(true);
+    return response;
+}
+
+dmonitor::QueryRequest ZlibRequest() {
+    dmonitor::QueryRequest request;
+    request.add_accept_codecs(dmonitor::CODEC_ZLIB);
+    return request;
+}
+
+} // namespace
+
+TEST(PayloadCodecTest, CompressedResponseRoundTrips) {
+    const dmonitor::QueryResponse original = MakeOverview(200);
+    dmonitor::QueryResponse response = original;
+    payload::CompressResponse(ZlibRequest(), &response, payload::DEFAULT_MIN_BYTES);
+    ASSERT_EQ(response.codec(), dmonitor::CODEC_ZLIB);
+    EXPECT_EQ(response.metrics_size(), 0);
+    EXPECT_EQ(response.raw_size(), original.ByteSizeLong());
+    EXPECT_LT(response.compressed().size(), original.ByteSizeLong());
+
+    ASSERT_TRUE(payload::DecompressResponse(&response));
+    EXPECT_EQ(response.SerializeAsString(), original.SerializeAsString());
+}
+
+TEST(PayloadCodecTest, OldClientAndSmallResponsesStayPlain) {
+    const dmonitor::QueryResponse original = MakeOverview(200);
+    // 老客户端不填accept_codecs, 响应原样返回, 解压这一步也原样通过
+    dmonitor::QueryResponse response = original;
+    payload::CompressResponse(dmonitor::QueryRequest(), &response, payload::DEFAULT_MIN_BYTES);
+    EXPECT_EQ(response.codec(), dmonitor::CODEC_NONE);
+    EXPECT_EQ(response.SerializeAsString(), original.SerializeAsString());
+    ASSERT_TRUE(payload::DecompressResponse(&response));
+    EXPECT_EQ(response.metrics_size(), 200);
+
+    // 不到阈值的响应不压缩
+    dmonitor::QueryResponse small = MakeOverview(1);
+    payload::CompressResponse(ZlibRequest(), &small, payload::DEFAULT_MIN_BYTES);
+    EXPECT_EQ(small.codec(), dmonitor::CODEC_NONE);
+    EXPECT_EQ(small.metrics_size(), 1);
+}
+
+TEST(PayloadCodecTest, RejectsBogusRawSize) {
+    dmonitor::QueryResponse response = MakeOverview(200);
+    payload::CompressResponse(ZlibRequest(), &response, payload::DEFAULT_MIN_BYTES);
+    ASSERT_EQ(response.codec(), dmonitor::CODEC_ZLIB);
+    const uint32_t raw_size = response.raw_size();
+
+    // 超过上限的raw_size不分配内存, 直接失败
+    dmonitor::QueryResponse huge = response;
+    huge.set_raw_size(static_cast<uint32_t>(payload::MAX_RAW_BYTES + 1));
+    EXPECT_FALSE(payload::DecompressResponse(&huge));
+
+    // 和解出来的长度对不上也算失败
+    dmonitor::QueryResponse shorter = response;
+    shorter.set_raw_size(raw_size - 1);
+    EXPECT_FALSE(payload::DecompressResponse(&shorter));
+    dmonitor::QueryResponse longer = response;
+    longer.set_raw_size(raw_size + 1);
+    EXPECT_FALSE(payload::DecompressResponse(&longer));
+
+    // 不认识的编码
+    dmonitor::QueryResponse unknown = response;
+    unknown.set_codec(static_cast<dmonitor::Codec>(7));
+    EXPECT_FALSE(payload::DecompressResponse(&unknown));
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <set>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "process_scanner.h"
+
+namespace {
+
+// 造一个只有<pid>/stat的假/proc目录
+std::string MakeProcDir(int processes) {
+    std::string root = testing::TempDir() + "scanner_proc_" + std::to_string(getpid());
+    mkdir(root.c_str(), 0755);
+    for (int pid = 1; pid <= processes; ++pid) {
+        std::string dir = root + "/" + std::to_string(pid);
+        mkdir(dir.c_str(), 0755);
+        std::ofstream stat(dir + "/stat");
+        // utime/stime是第14/15个字段, rss是第24个
+        stat << pid << " (proc " << pid << ") S 1 1 1 0 -1 4194304 0 0 0 0 "
+             << pid << " 0 0 0 20 0 1 0 100 1000000 " << pid << " 0\n";
+    }
+    return root;
+}
+
+} // namespace
+
+TEST(ProcessScannerTest, TruncatedScansRotateThroughAllProcesses) {
+    constexpr int kProcesses = 300;
+    ProcessScanner scanner(MakeProcDir(kProcesses));
+    ASSERT_TRUE(scanner.Open());
+
+    // 预算为0时每扫64个就超时, 连续几次扫描要接着上一次停下的位置, 最终每个进程都扫到
+    std::set<int32_t> seen;
+    std::vector<ProcessSample> top_cpu, top_rss;
+    int scans = 0;
+    while (seen.size() < kProcesses && scans < 10) {
+        EXPECT_FALSE(scanner.Scan(kProcesses, std::chrono::milliseconds(0), &top_cpu, &top_rss));
+        EXPECT_EQ(top_rss.size(), 64u);
+        for (const auto& sample : top_rss) {
+            seen.insert(sample.pid);
+        }
+        ++scans;
+    }
+    EXPECT_EQ(seen.size(), static_cast<size_t>(kProcesses));
+    EXPECT_EQ(scans, (kProcesses + 63) / 64);
+
+    // 预算足够时一次扫完
+    EXPECT_TRUE(scanner.Scan(5, std::chrono::milliseconds(1000), &top_cpu, &top_rss));
+    ASSERT_EQ(top_rss.size(), 5u);
+    EXPECT_EQ(top_rss[0].pid, kProcesses);
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+
+#include "procfs_sampler.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// 把fixtures/proc拷到临时目录, 采样器指向这份拷贝; 之后用proc-next里的文件原地覆盖, 模拟下一次采样
+class ProcfsSamplerTest : public testing::Test {
+protected:
+    void SetUp() override {
+        root_ = testing::TempDir() + "procfs_fixture_" + std::to_string(getpid());
+        fs::remove_all(root_);
+        fs::copy(std::string(FIXTURES_DIR) + "/proc", root_, fs::copy_options::recursive);
+    }
+    void TearDown() override { fs::remove_all(root_); }
+
+    // 原地重写(同一个inode), 采样器一直开着的fd读到的是新内容
+    void Advance() {
+        std::string next = std::string(FIXTURES_DIR) + "/proc-next";
+        for (const auto& entry : fs::recursive_directory_iterator(next)) {
+            if (!entry.is_regular_file()) {
+                continue;
+            }
+            std::ifstream in(entry.path());
+            std::stringstream content;
+            content << in.rdbuf();
+            std::ofstream out(root_ + "/" + fs::relative(entry.path(), next).string(), std::ios::trunc);
+            out << content.str();
+        }
+    }
+
+    std::string root_;
+};
+
+} // namespace
+
+TEST_F(ProcfsSamplerTest, ParsesFixtureSnapshots) {
+    ProcfsSampler sampler(root_);
+    ASSERT_TRUE(sampler.Open());
+
+    EXPECT_FLOAT_EQ(sampler.CpuUsage(), 0.0f); // 第一次没有上一次的计数
+    EXPECT_FLOAT_EQ(sampler.MemoryUsage(), 25.0f);
+    ExtendedSample sample;
+    sampler.CollectExtended(&sample);
+    ASSERT_EQ(sample.core_usage.size(), 2u);
+    EXPECT_FLOAT_EQ(sample.load1, 0.52f);
+    EXPECT_FLOAT_EQ(sample.load5, 0.58f);
+    EXPECT_FLOAT_EQ(sample.load15, 0.59f);
+    // loop和ram设备、分区都不报; nvme0n10和md12名字以整盘开头, 但不是分区
+    ASSERT_EQ(sample.disks.size(), 5u);
+    EXPECT_EQ(sample.disks[0].name, "sda");
+    EXPECT_EQ(sample.disks[1].name, "nvme0n1");
+    EXPECT_EQ(sample.disks[2].name, "nvme0n10");
+    EXPECT_EQ(sample.disks[3].name, "md1");
+    EXPECT_EQ(sample.disks[4].name, "md12");
+    ASSERT_EQ(sample.nets.size(), 1u);
+    EXPECT_EQ(sample.nets[0].name, "eth0");
+    EXPECT_EQ(sample.disks[0].in_bps, 0.0f);
+
+    Advance();
+    usleep(10000);
+    // cpu: 总共多了4000, 空闲多了3000; cpu0一半忙, cpu1全空闲
+    EXPECT_FLOAT_EQ(sampler.CpuUsage(), 25.0f);
+    sampler.CollectExtended(&sample);
+    ASSERT_EQ(sample.core_usage.size(), 2u);
+    EXPECT_FLOAT_EQ(sample.core_usage[0], 50.0f);
+    EXPECT_FLOAT_EQ(sample.core_usage[1], 0.0f);
+    // 速率和两次之间的时间有关, 只比读写之比: sda读2000扇区写4000, nvme0n1读1000写3000,
+    // nvme0n10读100写400, md1读10写50, md12读10写60, eth0收1MB发0.5MB
+    ASSERT_EQ(sample.disks.size(), 5u);
+    ASSERT_GT(sample.disks[0].in_bps, 0.0f);
+    EXPECT_NEAR(sample.disks[0].out_bps / sample.disks[0].in_bps, 2.0, 1e-4);
+    EXPECT_NEAR(sample.disks[1].out_bps / sample.disks[1].in_bps, 3.0, 1e-4);
+    EXPECT_NEAR(sample.disks[2].out_bps / sample.disks[2].in_bps, 4.0, 1e-4);
+    EXPECT_NEAR(sample.disks[3].out_bps / sample.disks[3].in_bps, 5.0, 1e-4);
+    EXPECT_NEAR(sample.disks[4].out_bps / sample.disks[4].in_bps, 6.0, 1e-4);
+    ASSERT_EQ(sample.nets.size(), 1u);
+    EXPECT_NEAR(sample.nets[0].out_bps / sample.nets[0].in_bps, 0.5, 1e-4);
+}
+
+TEST(ProcfsParseTest, Helpers) {
+    const char text[] = "  12345 0.75 word: rest\nnext";
+    const char* ptr = text;
+    const char* end = text + sizeof(text) - 1;
+    uint64_t value;
+    ASSERT_TRUE(procfs::ParseU64(ptr, end, &value));
+    EXPECT_EQ(value, 12345u);
+    float f;
+    ASSERT_TRUE(procfs::ParseFloat(ptr, end, &f));
+    EXPECT_FLOAT_EQ(f, 0.75f);
+    const char* word;
+    size_t len;
+    ASSERT_TRUE(procfs::ParseWord(ptr, end, &word, &len));
+    EXPECT_EQ(std::string(word, len), "word");
+    procfs::SkipLine(ptr, end);
+    EXPECT_TRUE(procfs::StartsWith(ptr, end, "next", 4));
+    EXPECT_EQ(ptr, end);
+    EXPECT_FALSE(procfs::ParseU64(ptr, end, &value));
+}
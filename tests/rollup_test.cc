@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include "rollup.h"
+
+namespace {
+
+constexpr int64_t kSecond = 1000;
+constexpr int64_t kHour = 3600 * kSecond;
+
+// 从start开始每interval一条, 共count条
+void Fill(Rollups* rollups, int64_t start, int64_t interval, int count) {
+    for (int i = 0; i < count; ++i) {
+        rollups->Add({start + i * interval, 10.0f, 20.0f});
+    }
+}
+
+} // namespace
+
+TEST(RollupTest, SeriesYoungerThanWindowKeepsFinestFittingLevel) {
+    // 序列只有5分钟的数据, 起点不在整点上, 查最近1小时、步长1分钟
+    Rollups rollups;
+    int64_t first = 100 * kHour + 34 * 60 * kSecond + 56 * kSecond;
+    Fill(&rollups, first, 3 * kSecond, 100);
+    int64_t now = first + 300 * kSecond;
+
+    const RollupRing* ring = rollups.Pick(60 * kSecond, now - kHour);
+    ASSERT_NE(ring, nullptr);
+    EXPECT_EQ(ring->width(), 60 * kSecond);
+    std::vector<RollupBucket> buckets;
+    ring->Query(now - kHour, now, &buckets);
+    EXPECT_GE(buckets.size(), 5u);
+}
+
+TEST(RollupTest, WindowLongerThanFinestRetentionStaysOnFinestUntilItWraps) {
+    // 30分钟的数据, 查最近2小时、步长10秒: 10秒的分辨率还没写满, 不能换成1小时的单个点
+    Rollups rollups;
+    int64_t first = 200 * kHour + 7 * kSecond;
+    Fill(&rollups, first, 3 * kSecond, 600);
+    int64_t now = first + 1800 * kSecond;
+
+    const RollupRing* ring = rollups.Pick(10 * kSecond, now - 2 * kHour);
+    ASSERT_NE(ring, nullptr);
+    EXPECT_EQ(ring->width(), 10 * kSecond);
+    std::vector<RollupBucket> buckets;
+    ring->Query(now - 2 * kHour, now, &buckets);
+    EXPECT_GE(buckets.size(), 180u);
+}
+
+TEST(RollupTest, WrappedLevelFallsBackToCoarserWithOlderData) {
+    // 3小时的数据, 10秒的分辨率只留了最近1小时, 查3小时时换到保留得更久的1分钟
+    Rollups rollups;
+    int64_t first = 300 * kHour;
+    Fill(&rollups, first, 10 * kSecond, 3 * 360);
+    ASSERT_TRUE(rollups.level(0).full());
+
+    const RollupRing* ring = rollups.Pick(10 * kSecond, first);
+    ASSERT_NE(ring, nullptr);
+    EXPECT_EQ(ring->width(), 60 * kSecond);
+    EXPECT_LE(ring->at(0).start, first);
+
+    // 起点还在10秒分辨率的范围里时不换
+    ring = rollups.Pick(10 * kSecond, first + 2 * kHour + 60 * kSecond);
+    ASSERT_NE(ring, nullptr);
+    EXPECT_EQ(ring->width(), 10 * kSecond);
+}
+
+TEST(RollupTest, StepFinerThanFinestLevelUsesRawData) {
+    Rollups rollups;
+    Fill(&rollups, kHour, kSecond, 10);
+    EXPECT_EQ(rollups.Pick(5 * kSecond, kHour), nullptr);
+}
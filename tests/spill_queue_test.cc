@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <string>
+#include <unistd.h>
+
+#include "spill_queue.h"
+
+namespace {
+
+// 文件头: magic(8) + capacity/head/tail/count(各8字节), 数据区紧跟在后面
+const off_t DATA_OFFSET = 40;
+const size_t CAPACITY = 4096;
+
+std::string SpillPath(const char* name) {
+    std::string path = testing::TempDir() + name + std::to_string(getpid()) + ".spill";
+    unlink(path.c_str());
+    return path;
+}
+
+std::string MakeRecord(size_t size) {
+    return std::string(size, static_cast<char>('a' + size % 26));
+}
+
+void CorruptLength(const std::string& path, uint32_t len) {
+    int fd = open(path.c_str(), O_WRONLY);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(pwrite(fd, &len, sizeof(len), DATA_OFFSET), static_cast<ssize_t>(sizeof(len)));
+    close(fd);
+}
+
+} // namespace
+
+TEST(SpillQueueTest, RoundTrip) {
+    std::string path = SpillPath("spill_roundtrip_");
+    SpillQueue queue;
+    ASSERT_TRUE(queue.Open(path, CAPACITY));
+    ASSERT_TRUE(queue.Push(MakeRecord(100)));
+    ASSERT_TRUE(queue.Push(MakeRecord(200)));
+    EXPECT_EQ(queue.count(), 2u);
+
+    std::string record;
+    ASSERT_TRUE(queue.Front(&record));
+    EXPECT_EQ(record, MakeRecord(100));
+    queue.Pop();
+    ASSERT_TRUE(queue.Front(&record));
+    EXPECT_EQ(record, MakeRecord(200));
+    queue.Pop();
+    EXPECT_TRUE(queue.empty());
+    unlink(path.c_str());
+}
+
+TEST(SpillQueueTest, CorruptRecordLengthResetsQueue) {
+    for (uint32_t bad_len : {0xFFFFFFFFu, static_cast<uint32_t>(CAPACITY - 8), 3000u}) {
+        std::string path = SpillPath("spill_corrupt_");
+        {
+            SpillQueue queue;
+            ASSERT_TRUE(queue.Open(path, CAPACITY));
+            ASSERT_TRUE(queue.Push(MakeRecord(100)));
+            ASSERT_TRUE(queue.Push(MakeRecord(100)));
+        }
+        CorruptLength(path, bad_len);
+
+        SpillQueue queue;
+        ASSERT_TRUE(queue.Open(path, CAPACITY));
+        ASSERT_FALSE(queue.empty());
+        std::string record;
+        EXPECT_FALSE(queue.Front(&record));
+        EXPECT_TRUE(queue.empty());
+        EXPECT_EQ(queue.count(), 0u);
+        EXPECT_EQ(queue.dropped(), 2u);
+        // 清空后还能正常使用
+        ASSERT_TRUE(queue.Push(MakeRecord(50)));
+        ASSERT_TRUE(queue.Front(&record));
+        EXPECT_EQ(record, MakeRecord(50));
+        unlink(path.c_str());
+    }
+}
+
+TEST(SpillQueueTest, PopOfCorruptRecordDoesNotOverrun) {
+    std::string path = SpillPath("spill_pop_");
+    {
+        SpillQueue queue;
+        ASSERT_TRUE(queue.Open(path, CAPACITY));
+        ASSERT_TRUE(queue.Push(MakeRecord(100)));
+    }
+    CorruptLength(path, 2000);
+
+    SpillQueue queue;
+    ASSERT_TRUE(queue.Open(path, CAPACITY));
+    queue.Pop();
+    EXPECT_TRUE(queue.empty());
+    unlink(path.c_str());
+}
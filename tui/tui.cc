@@ -8,16 +8,21 @@
 #include <memory>
 #include <mutex>
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <functional>
 
 // 引入你的RPC和Protobuf头文件
 #include "Krpcapplication.h"
 #include "Krpcchannel.h"
 #include "monitor.pb.h"
+#include "async_channel.h"
+#include "payload_codec.h"
 
 // FTXUI 头文件
 #include <ftxui/dom/elements.hpp>
 #include <ftxui/screen/screen.hpp>
+#include <ftxui/screen/terminal.hpp>
 #include <ftxui/component/component.hpp>
 #include <ftxui/component/screen_interactive.hpp>
 #include <ftxui/component/event.hpp>
@@ -33,6 +38,19 @@ struct ServerMetrics {
     bool online;
 };
 
+// 一次异步调用: 请求, 响应和完成后要做的事放在一起. 完成时在AsyncChannel的工作线程里执行, 然后删除自己
+template <typename Request, typename Response>
+struct PendingCall : public google::protobuf::Closure {
+    Request request;
+    Response response;
+    std::function<void(PendingCall&)> on_done;
+
+    void Run() override {
+        on_done(*this);
+        delete this;
+    }
+};
+
 // --- 工具函数 ---
 
 // 获取当前时间 HH:MM:SS
@@ -87,17 +105,18 @@ class DistributedMonitor {
 public:
     DistributedMonitor() : selected_index_(0), show_details_(false) {
         // 初始化 stub
-        stub_ = std::make_unique<dmonitor::MonitorQueryServiceRpc_Stub>(new KrpcChannel(false));
+        stub_ = std::make_unique<dmonitor::MonitorQueryServiceRpc_Stub>(&channel_);
     }
 
     void Run() {
         auto screen = ScreenInteractive::Fullscreen();
 
-        // 后台刷新线程
+        // 后台刷新线程: 每秒发一次概览查询, 详情页再发一次历史查询, 两个调用经AsyncChannel的两条连接同时在途.
+        // 结果在完成回调里写入并触发重绘; 上一次的还没回来就跳过这一轮, 不让慢的center堆积请求
         std::thread updater([this, &screen] {
             while (!should_exit_) {
-                FetchData();
-                screen.PostEvent(Event::Custom); // 触发重绘
+                FetchData(screen);
+                if (show_details_) FetchHistory(screen);
                 std::this_thread::sleep_for(std::chrono::seconds(1));
             }
         });
@@ -117,15 +136,21 @@ public:
                 }
             } else {
                 if (event == Event::ArrowDown || event == Event::Character('j')) {
+                    std::lock_guard<std::mutex> lock(data_mutex_);
                     if (!servers_.empty()) selected_index_ = (selected_index_ + 1) % servers_.size();
                     return true;
                 }
                 if (event == Event::ArrowUp || event == Event::Character('k')) {
+                    std::lock_guard<std::mutex> lock(data_mutex_);
                     if (!servers_.empty()) selected_index_ = (selected_index_ + servers_.size() - 1) % servers_.size();
                     return true;
                 }
                 if (event == Event::Return) {
-                    if (!servers_.empty()) show_details_ = true;
+                    if (!servers_.empty()) {
+                        std::lock_guard<std::mutex> lock(data_mutex_);
+                        history_.clear();
+                        show_details_ = true;
+                    }
                     return true;
                 }
                 if (event == Event::Escape || event == Event::Character('q')) {
@@ -140,22 +165,45 @@ public:
         screen.Loop(component);
         should_exit_ = true;
         if (updater.joinable()) updater.join();
+        // 完成回调要用到screen, 等在途的调用都回来再返回
+        while (in_flight_ > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
     }
 
 private:
+    AsyncChannel channel_{2}; // 两条连接, 概览和历史可以同时在途
     std::unique_ptr<dmonitor::MonitorQueryServiceRpc_Stub> stub_;
+    std::mutex data_mutex_; // 保护下面的servers_, selected_index_和history_
     std::vector<ServerMetrics> servers_;
-    std::mutex data_mutex_;
-    bool should_exit_ = false;
-    int selected_index_;
-    bool show_details_;
-
-    // 获取数据
-    void FetchData() {
-        dmonitor::QueryRequest req;
-        dmonitor::QueryResponse rsp;
-        req.set_server_name(""); // 空字符串表示获取所有
-        stub_->Query(nullptr, &req, &rsp, nullptr);
+    size_t selected_index_;
+    std::vector<dmonitor::RangePoint> history_; // 详情页的最近1小时曲线
+    // UI线程写, 刷新线程和完成回调读
+    std::atomic<bool> should_exit_{false};
+    std::atomic<bool> show_details_;
+    // 在途的调用: 每种查询同一时刻最多一个
+    std::atomic<int> in_flight_{0};
+    std::atomic<bool> query_pending_{false};
+    std::atomic<bool> history_pending_{false};
+
+    // 获取所有服务器的概览, 完成后更新列表并重绘
+    void FetchData(ScreenInteractive& screen) {
+        if (query_pending_.exchange(true)) return;
+        auto* call = new PendingCall<dmonitor::QueryRequest, dmonitor::QueryResponse>();
+        call->request.set_server_name(""); // 空字符串表示获取所有
+        call->request.add_accept_codecs(dmonitor::CODEC_ZLIB); // 全量概览很大, 让center压缩
+        call->on_done = [this, &screen](PendingCall<dmonitor::QueryRequest, dmonitor::QueryResponse>& call) {
+            OnData(call.response);
+            query_pending_ = false;
+            screen.PostEvent(Event::Custom); // 触发重绘
+            --in_flight_; // 最后再减, Run()看到0之后回调不再碰screen
+        };
+        ++in_flight_;
+        stub_->Query(nullptr, &call->request, &call->response, call);
+    }
+
+    void OnData(dmonitor::QueryResponse& rsp) {
+        if (!payload::DecompressResponse(&rsp)) return;
 
         std::lock_guard<std::mutex> lock(data_mutex_);
         if (rsp.metrics_size() > 0) {
@@ -175,6 +223,59 @@ private:
         }
     }
 
+    // 获取选中服务器最近1小时的历史, 点数按终端宽度要, 由center降采样
+    void FetchHistory(ScreenInteractive& screen) {
+        if (history_pending_.exchange(true)) return;
+        auto* call = new PendingCall<dmonitor::RangeQueryRequest, dmonitor::RangeQueryResponse>();
+        {
+            std::lock_guard<std::mutex> lock(data_mutex_);
+            if (servers_.empty() || selected_index_ >= servers_.size()) {
+                delete call;
+                history_pending_ = false;
+                return;
+            }
+            call->request.set_server_name(servers_[selected_index_].name);
+        }
+        call->request.set_max_points(std::max(Terminal::Size().dimx, 20));
+        call->request.add_accept_codecs(dmonitor::CODEC_ZLIB);
+        call->on_done = [this, &screen](PendingCall<dmonitor::RangeQueryRequest, dmonitor::RangeQueryResponse>& call) {
+            OnHistory(call.request.server_name(), call.response);
+            history_pending_ = false;
+            screen.PostEvent(Event::Custom);
+            --in_flight_; // 最后再减, Run()看到0之后回调不再碰screen
+        };
+        ++in_flight_;
+        stub_->QueryRange(nullptr, &call->request, &call->response, call);
+    }
+
+    void OnHistory(const std::string& server_name, dmonitor::RangeQueryResponse& rsp) {
+        if (!payload::DecompressResponse(&rsp)) return;
+
+        std::lock_guard<std::mutex> lock(data_mutex_);
+        // 查询在途时可能已经退出详情页或换了服务器, 过期的结果不要
+        if (rsp.success() && show_details_ && selected_index_ < servers_.size() &&
+            servers_[selected_index_].name == server_name) {
+            history_.assign(rsp.points().begin(), rsp.points().end());
+        }
+    }
+
+    // 把历史曲线画成graph, 取每一列对应时间段的最大值, 尖刺不会被抹平
+    Element DrawHistoryGraph(bool cpu, Color c) {
+        std::vector<dmonitor::RangePoint> points = history_;
+        auto fn = [points, cpu](int width, int height) {
+            std::vector<int> output(width, 0);
+            if (points.empty()) return output;
+            for (int x = 0; x < width; ++x) {
+                size_t i = points.size() * x / width;
+                float value = cpu ? points[i].cpu_max() : points[i].memory_max();
+                value = std::max(0.0f, std::min(100.0f, value));
+                output[x] = static_cast<int>(value * height / 100.0f);
+            }
+            return output;
+        };
+        return graph(fn) | color(c) | size(HEIGHT, EQUAL, 6);
+    }
+
     // 主页面渲染
     Element RenderMainPage() {
         std::lock_guard<std::mutex> lock(data_mutex_);
@@ -296,6 +397,11 @@ private:
             text("Realtime Metrics:") | bold,
             hbox({ text("CPU: "), DrawCustomProgressBar(cpu_percent) | flex, text(" " + std::to_string(cpu_percent) + "%") }),
             hbox({ text("MEM: "), DrawCustomProgressBar(mem_percent) | flex, text(" " + std::to_string(mem_percent) + "%") }),
+            text(""),
+            text("CPU (last 1h):") | bold,
+            DrawHistoryGraph(true, Color::Green),
+            text("MEM (last 1h):") | bold,
+            DrawHistoryGraph(false, Color::Cyan),
         }) | border | size(WIDTH, GREATER_THAN, 60) | center;
 
         return vbox({